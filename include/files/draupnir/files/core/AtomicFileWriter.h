@@ -0,0 +1,75 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef ATOMICFILEWRITER_H
+#define ATOMICFILEWRITER_H
+
+#include <QIODevice>
+#include <QString>
+
+#include <expected>
+
+namespace Draupnir::Files
+{
+
+/*! @enum FileSyncPolicy draupnir/files/core/AtomicFileWriter.h
+ *  @ingroup Files
+ *  @brief Defines how written data is flushed to the storage device by @ref Draupnir::Files::AtomicFileWriter. */
+
+enum class FileSyncPolicy : quint8 {
+    /*! @brief Data is left in the OS cache. Fastest, suitable for bulk jobs which can be repeated after a crash. */
+    None,
+    /*! @brief File data is synced to the storage device (`fdatasync`) before the rename. */
+    Data,
+    /*! @brief File data and metadata are synced (`fsync`) before the rename, and the directory entry is synced after it. */
+    Full
+};
+
+/*! @class AtomicFileWriter draupnir/files/core/AtomicFileWriter.h
+ *  @ingroup Files
+ *  @brief Writes files by writing into a temporary file within the same directory and renaming it over the destination.
+ *
+ *  @details Destination file either keeps its old contents or gets the complete new contents, even if the application
+ *           crashes during writing. Permissions of the existing destination file are preserved. If destination is a
+ *           symbolic link, the file it points to is replaced. Existing destination which is not writable is not replaced.
+ *
+ *           Durability is controlled by @ref Draupnir::Files::FileSyncPolicy. */
+
+class AtomicFileWriter
+{
+public:
+    /*! @brief Writes @p data into the file under @p filePath.
+     *  @param filePath Destination file path.
+     *  @param data Data to be written.
+     *  @param extraFlags Additional open flags (e.g. QIODevice::Text).
+     *  @param syncPolicy Sync policy to be used.
+     *  @return Empty result on success or an error message on failure. */
+    static std::expected<void,QString> write(const QString& filePath, const QByteArray& data,
+                                             QIODevice::OpenMode extraFlags = {},
+                                             FileSyncPolicy syncPolicy = FileSyncPolicy::Full);
+};
+
+}; // namespace Draupnir::Files
+
+#endif // ATOMICFILEWRITER_H
@@ -0,0 +1,80 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef CONTENTHASHER_H
+#define CONTENTHASHER_H
+
+#include <QByteArray>
+
+namespace Draupnir::Files
+{
+
+/*! @class ContentHasher draupnir/files/core/ContentHasher.h
+ *  @ingroup Files
+ *  @brief Incremental implementation of the 64-bit xxHash (XXH64) algorithm used to detect changes of file contents.
+ *
+ *  @details XXH64 is not a cryptographic hash, but it processes several gigabytes per second, so hashing is cheap
+ *           compared to reading or writing the file. Data may be passed at once or in arbitrary chunks, result is the same.
+ *           @code
+ *           ContentHasher hasher;
+ *           hasher.addData(firstChunk);
+ *           hasher.addData(secondChunk);
+ *           const quint64 hash = hasher.result();
+ *           @endcode */
+
+class ContentHasher
+{
+public:
+    /*! @brief Constructor. Creates hasher with provided @p seed. */
+    explicit ContentHasher(quint64 seed = 0);
+
+    /*! @brief Resets hasher to its initial state. */
+    void reset();
+
+    /*! @brief Adds @p size bytes from @p data to the hash. */
+    void addData(const char* data, qint64 size);
+
+    /*! @brief Adds @p data to the hash. */
+    void addData(const QByteArray& data) { addData(data.constData(), data.size()); }
+
+    /*! @brief Returns hash of all data added so far. Hasher may be used further after calling this method. */
+    quint64 result() const;
+
+    /*! @brief Returns amount of bytes added so far. */
+    qint64 size() const { return m_totalSize; }
+
+    /*! @brief Returns hash of @p data. */
+    static quint64 hash(const QByteArray& data, quint64 seed = 0);
+
+private:
+    quint64 m_seed;
+    quint64 m_accumulators[4];
+    char m_buffer[32];
+    int m_bufferSize;
+    qint64 m_totalSize;
+};
+
+}; // namespace Draupnir::Files
+
+#endif // CONTENTHASHER_H
@@ -0,0 +1,118 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef FILEWATCHERSERVICE_H
+#define FILEWATCHERSERVICE_H
+
+#include <QObject>
+
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QMultiHash>
+#include <QRecursiveMutex>
+#include <QTimer>
+
+#include <functional>
+
+namespace Draupnir::Files
+{
+
+class AbstractFile;
+
+/*! @class FileWatcherService draupnir/files/core/FileWatcherService.h
+ *  @ingroup Files
+ *  @brief Process-wide watcher of files opened by @ref Draupnir::Files::AbstractFile objects.
+ *
+ *  @details All AbstractFile objects register their paths here, so a single QFileSystemWatcher (and thus a single inotify
+ *           instance on Linux) is used for the whole application. Each path is watched once, regardless of how many files
+ *           refer to it.
+ *
+ *           Events are coalesced per path: the registered files are notified once the path was quiet for
+ *           @ref debounceInterval milliseconds. Editors saving by truncate + write + rename therefore produce a single
+ *           notification per save. QFileSystemWatcher stops watching a file once it is removed or replaced by rename, so
+ *           such paths are re-armed as soon as the file exists again.
+ *
+ *           The service lives on the thread of QCoreApplication. @ref watch and @ref unwatch may be called from any thread
+ *           (AbstractFile objects are opened and saved on worker threads too): registrations are guarded by a mutex and
+ *           QFileSystemWatcher is only touched on the thread of the service. Files are notified with the registrations
+ *           locked, so a file being destroyed on another thread waits until its notification returns. */
+
+class FileWatcherService final : public QObject
+{
+    Q_OBJECT
+public:
+    /*! @brief Default value of @ref debounceInterval in milliseconds. */
+    static constexpr int defaultDebounceInterval = 100;
+
+    /*! @brief Returns the service instance. It is created on the first call, moved to the thread of QCoreApplication and
+     *         parented to it. Returns `nullptr` if there is no QCoreApplication (e.g. it was already destroyed). */
+    static FileWatcherService* instance();
+
+    /*! @brief Sets time (in milliseconds) a path must be quiet before the registered files are notified. */
+    void setDebounceInterval(int milliseconds);
+
+    /*! @brief Returns time (in milliseconds) a path must be quiet before the registered files are notified. */
+    int debounceInterval() const { return m_debounceInterval; }
+
+    /*! @brief Registers @p file to be notified about changes of @p filePath. Calling it again for already registered
+     *         pair starts watching the path if the file did not exist before. */
+    void watch(const QString& filePath, AbstractFile* file);
+
+    /*! @brief Removes registration made by @ref watch. Path is no longer watched once the last file is unregistered. */
+    void unwatch(const QString& filePath, AbstractFile* file);
+
+    /*! @brief Returns `true` if at least one file is registered for @p filePath. */
+    bool isWatched(const QString& filePath) const;
+
+private:
+    explicit FileWatcherService(QObject* parent = nullptr);
+
+    QFileSystemWatcher m_watcher;
+    mutable QRecursiveMutex m_filesMutex;       ///< Guards m_files. Recursive, as notified files may unwatch themselves.
+    QMultiHash<QString,AbstractFile*> m_files;
+    QHash<QString,qint64> m_pendingDeadlines;  ///< Time (from m_clock) when pending path should be dispatched.
+    QElapsedTimer m_clock;
+    QTimer m_dispatchTimer;
+    int m_debounceInterval;
+
+    /*! @brief Postpones dispatching of the @p filePath. Connected to QFileSystemWatcher::fileChanged. */
+    void _onRawFileChanged(const QString& filePath);
+
+    /*! @brief Notifies files of all paths which were quiet long enough and reschedules the timer for the rest. */
+    void _dispatchPending();
+
+    /*! @brief Watches @p filePath again if QFileSystemWatcher dropped it and files are still registered for it. */
+    void _rearm(const QString& filePath);
+
+    /*! @brief Stops watching @p filePath unless files were registered for it again meanwhile. */
+    void _release(const QString& filePath);
+
+    /*! @brief Executes @p function on the thread of the service: directly if called from it, queued otherwise. */
+    void _invokeOnServiceThread(std::function<void()> function);
+};
+
+}; // namespace Draupnir::Files
+
+#endif // FILEWATCHERSERVICE_H
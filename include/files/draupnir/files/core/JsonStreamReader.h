@@ -0,0 +1,143 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef JSONSTREAMREADER_H
+#define JSONSTREAMREADER_H
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QString>
+
+#include <expected>
+
+namespace Draupnir::Files
+{
+
+/*! @class JsonStreamHandler draupnir/files/core/JsonStreamReader.h
+ *  @ingroup Files
+ *  @brief Interface receiving events of @ref Draupnir::Files::JsonStreamReader.
+ *
+ *  @details Events are reported in document order. Returning an error from any of the methods aborts parsing and the
+ *           error is returned from JsonStreamReader::addData / JsonStreamReader::finish. */
+
+class JsonStreamHandler
+{
+public:
+    virtual ~JsonStreamHandler() = default;
+
+    /*! @brief Called when `{` is parsed. */
+    virtual std::expected<void,QString> jsonObjectStarted() = 0;
+
+    /*! @brief Called when `}` is parsed. */
+    virtual std::expected<void,QString> jsonObjectFinished() = 0;
+
+    /*! @brief Called when `[` is parsed. */
+    virtual std::expected<void,QString> jsonArrayStarted() = 0;
+
+    /*! @brief Called when `]` is parsed. */
+    virtual std::expected<void,QString> jsonArrayFinished() = 0;
+
+    /*! @brief Called for every key of an object. It is followed by a value, object or array. */
+    virtual std::expected<void,QString> jsonKeyParsed(const QString& key) = 0;
+
+    /*! @brief Called for every string, number, boolean or null value. */
+    virtual std::expected<void,QString> jsonValueParsed(const QJsonValue& value) = 0;
+};
+
+/*! @class JsonStreamReader draupnir/files/core/JsonStreamReader.h
+ *  @ingroup Files
+ *  @brief Incremental (SAX-style) JSON parser reporting document structure to @ref Draupnir::Files::JsonStreamHandler.
+ *
+ *  @details Data may be passed in arbitrary chunks; only the token split between chunks is buffered, so no document
+ *           object model is built. Nesting depth is limited by @ref maximumDepth.
+ *           @code
+ *           JsonStreamReader reader{&handler};
+ *           reader.addData(firstChunk);
+ *           reader.addData(secondChunk);
+ *           reader.finish();
+ *           @endcode */
+
+class JsonStreamReader
+{
+public:
+    /*! @brief Maximal nesting depth of objects and arrays. */
+    static constexpr int maximumDepth = 1024;
+
+    /*! @brief Constructor. @p handler must outlive this object. */
+    explicit JsonStreamReader(JsonStreamHandler* handler);
+
+    /*! @brief Resets reader, so a new document can be parsed. */
+    void reset();
+
+    /*! @brief Parses next @p size bytes from @p data. After an error reader must be reset before further use. */
+    std::expected<void,QString> addData(const char* data, qint64 size);
+
+    /*! @brief Parses next chunk of @p data. */
+    std::expected<void,QString> addData(const QByteArray& data) { return addData(data.constData(), data.size()); }
+
+    /*! @brief Should be called after the last chunk. Returns an error if the document is incomplete. */
+    std::expected<void,QString> finish();
+
+    /*! @brief Returns amount of bytes parsed since the last reset. */
+    qint64 bytesProcessed() const { return m_bytesProcessed; }
+
+private:
+    enum class State : quint8 {
+        ExpectValue,
+        ExpectValueOrArrayEnd,
+        ExpectKeyOrObjectEnd,
+        ExpectKey,
+        ExpectColon,
+        ExpectCommaOrEnd,
+        Done
+    };
+
+    enum class Token : quint8 {
+        None,
+        String,
+        Literal
+    };
+
+    JsonStreamHandler* p_handler;
+    State m_state;
+    Token m_token;
+    bool m_escaped;
+    bool m_failed;
+    QByteArray m_tokenData;     ///< Part of the current token read so far, without quotes.
+    QByteArray m_containers;    ///< Stack of opened containers, `{` or `[`.
+    qint64 m_bytesProcessed;
+
+    bool _isValueExpected() const { return m_state == State::ExpectValue || m_state == State::ExpectValueOrArrayEnd; }
+    std::expected<void,QString> _structuralCharacterParsed(char character, qint64 offset);
+    std::expected<void,QString> _containerStarted(char container, qint64 offset);
+    std::expected<void,QString> _containerFinished(char container, qint64 offset);
+    std::expected<void,QString> _stringParsed(qint64 offset);
+    std::expected<void,QString> _literalParsed(qint64 offset);
+    void _valueParsed();
+    std::expected<void,QString> _error(const QString& message, qint64 offset);
+};
+
+}; // namespace Draupnir::Files
+
+#endif // JSONSTREAMREADER_H
@@ -0,0 +1,101 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef JSONSTREAMWRITER_H
+#define JSONSTREAMWRITER_H
+
+#include <QByteArray>
+#include <QJsonDocument>
+#include <QJsonValue>
+#include <QString>
+
+namespace Draupnir::Files
+{
+
+/*! @class JsonStreamWriter draupnir/files/core/JsonStreamWriter.h
+ *  @ingroup Files
+ *  @brief Writes JSON document element by element, without building a document object model.
+ *
+ *  @details Output of the JsonStreamWriter is the same as of QJsonDocument::toJson with the same format, so streamed and
+ *           DOM-based files are interchangeable. Writer does not validate the document; calling methods in invalid order
+ *           (e.g. writing a value inside of an object without a key) is caught by assertions only.
+ *           @code
+ *           QByteArray output;
+ *           JsonStreamWriter writer{&output};
+ *           writer.beginObject();
+ *           writer.writeKey("items");
+ *           writer.beginArray();
+ *           writer.writeValue(1);
+ *           writer.endArray();
+ *           writer.endObject();
+ *           @endcode */
+
+class JsonStreamWriter
+{
+public:
+    /*! @brief Constructor. Appends JSON data to @p output, which must outlive this object. */
+    explicit JsonStreamWriter(QByteArray* output, QJsonDocument::JsonFormat format = QJsonDocument::Indented);
+
+    /*! @brief Writes `{`. */
+    void beginObject();
+
+    /*! @brief Writes `}`. */
+    void endObject();
+
+    /*! @brief Writes `[`. */
+    void beginArray();
+
+    /*! @brief Writes `]`. */
+    void endArray();
+
+    /*! @brief Writes key of the next object member. */
+    void writeKey(const QString& key);
+
+    /*! @brief Writes @p value. QJsonObject and QJsonArray values are written recursively. */
+    void writeValue(const QJsonValue& value);
+
+    /*! @brief Writes object member with @p key and @p value. */
+    void writeMember(const QString& key, const QJsonValue& value) {
+        writeKey(key);
+        writeValue(value);
+    }
+
+private:
+    QByteArray* p_output;
+    QJsonDocument::JsonFormat m_format;
+    QByteArray m_containers;    ///< Stack of opened containers, `{` or `[`.
+    bool m_containerIsEmpty;    ///< Whether the innermost container has no elements yet.
+    bool m_keyWritten;          ///< Whether the key of the next object member was written.
+
+    bool _isIndented() const { return m_format == QJsonDocument::Indented; }
+    void _beforeElement();
+    void _beginContainer(char container);
+    void _endContainer(char container);
+    void _writeString(const QString& string);
+    void _elementWritten();
+};
+
+}; // namespace Draupnir::Files
+
+#endif // JSONSTREAMWRITER_H
@@ -0,0 +1,92 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef PARALLELFILEREADER_H
+#define PARALLELFILEREADER_H
+
+#include <QFileInfo>
+#include <QList>
+
+#include <expected>
+#include <functional>
+
+namespace Draupnir::Files
+{
+
+class AbstractFile;
+
+/*! @enum ResultOrder draupnir/files/core/ParallelFileReader.h
+ *  @ingroup Files
+ *  @brief Defines order in which @ref Draupnir::Files::ParallelFileReader delivers results. */
+
+enum class ResultOrder : quint8 {
+    /*! @brief Results are delivered in the order of the provided files. */
+    InOrder,
+    /*! @brief Results are delivered as soon as the corresponding file is read. */
+    AsCompleted
+};
+
+/*! @class ParallelFileReader draupnir/files/core/ParallelFileReader.h
+ *  @ingroup Files
+ *  @brief Reads and parses many @ref Draupnir::Files::AbstractFile objects concurrently on a bounded thread pool.
+ *
+ *  @details AbstractFile::readFile of every file is executed on a worker thread of a private QThreadPool, so total time
+ *           approaches disk bandwidth instead of the sum of parse times. Results are passed to the handler on the calling
+ *           thread, where AbstractFile::completeOpen may be called for the file. Handler is invoked while other files are
+ *           still being read, so it must not access any other file of the batch. */
+
+class ParallelFileReader
+{
+public:
+    /*! @brief Result of reading a single file. */
+    using Result = std::expected<void,QString>;
+
+    /*! @brief Handler receiving index of the file within the batch and its result. */
+    using ResultHandler = std::function<void(int index, const Result& result)>;
+
+    /*! @brief Constructor. By default QThread::idealThreadCount() threads are used. */
+    ParallelFileReader();
+
+    /*! @brief Sets maximal amount of worker threads. Values lower than 1 are treated as 1. */
+    void setMaxThreadCount(int count);
+
+    /*! @brief Returns maximal amount of worker threads. */
+    int maxThreadCount() const { return m_maxThreadCount; }
+
+    /*! @brief Reads @p files from corresponding @p fileInfos concurrently and blocks until all of them are read.
+     *  @param files Files to read into. Must not be accessed by other threads during this call.
+     *  @param fileInfos Files to read, same size as @p files.
+     *  @param order Order in which @p handler is invoked.
+     *  @param handler Handler invoked on the calling thread once for each file. May be empty.
+     *  @return Results in the order of @p files. */
+    QList<Result> read(const QList<AbstractFile*>& files, const QList<QFileInfo>& fileInfos,
+                       ResultOrder order = ResultOrder::InOrder, const ResultHandler& handler = {}) const;
+
+private:
+    int m_maxThreadCount;
+};
+
+}; // namespace Draupnir::Files
+
+#endif // PARALLELFILEREADER_H
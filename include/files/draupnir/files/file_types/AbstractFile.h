@@ -27,14 +27,21 @@
 
 #include <QObject>
 
+#include <atomic>
 #include <expected>
+#include <functional>
+#include <optional>
 
 #include <QFileInfo>
-#include <QFileSystemWatcher>
+
+#include "draupnir/files/core/AtomicFileWriter.h"
 
 namespace Draupnir::Files
 {
 
+class ContentHasher;
+class FileWatcherService;
+
 /*! @class AbstractFile draupnir/files/file_types/AbstractFile.h
  *  @ingroup Files
  *  @brief Abstract runtime base class for file objects used within Draupnir file management infrastructure.
@@ -44,14 +51,52 @@ namespace Draupnir::Files
  *           - tracking unsaved in-memory changes;
  *           - emitting signals when file metadata or save state changes.
  *
- *           The save() method saves the current file and is only valid for non-untitled files. */
+ *           The save() method saves the current file and is only valid for non-untitled files. Saving is done by
+ *           @ref Draupnir::Files::AtomicFileWriter, so a crash during saving never leaves a partially written file. How
+ *           much is flushed to the disk before saving is reported as successful can be selected by @ref setSyncPolicy.
+ *
+ *           Hash of the contents (see @ref Draupnir::Files::ContentHasher) and size of the file are remembered after
+ *           every load and save. Saving data identical to the one on disk is skipped, and fileChangedOnDisk() is emitted
+ *           only when the contents on disk really differ (e.g. not for our own saves or for a `touch`). Modification time
+ *           is never trusted, as filesystems with coarse timestamps do not change it for a quick rewrite of the same
+ *           length: whenever the size matches, the file on disk is hashed again. Files are watched by the shared
+ *           @ref Draupnir::Files::FileWatcherService, which coalesces bursts of events into one notification per change.
+ *           Memory-mapped loads do not hash the file, as this would read all of its pages; such files are always written
+ *           on save until they are saved once.
+ *
+ *           By default file contents are read at once and passed to @ref dataProcessed. Derived classes which can parse
+ *           their data incrementally may return a non-zero value from @ref loadChunkSize. In this case file is read in
+ *           fixed-size chunks: @ref chunkedLoadStarted is called once, then @ref dataChunkProcessed for every chunk and
+ *           @ref finish after the last one. Only one chunk is kept in memory at any time. If any of these methods fails,
+ *           loading is aborted and the error is returned from open(). Derived classes should therefore keep partially
+ *           parsed state aside and apply it only within @ref finish.
+ *
+ *           Derived classes which only read large files may return `true` from @ref isMemoryMappingEnabled. File is then
+ *           mapped into memory and data passed to @ref dataProcessed / @ref dataChunkProcessed refers directly to the
+ *           mapped pages, so nothing is copied and pages are loaded on demand. Such data stays valid until another file
+ *           is successfully opened by this object, until this object is saved over the mapped file or until this object
+ *           is destroyed. Before the mapping is released because of saving, @ref mappedDataAboutToBeReleased is called,
+ *           so derived classes can deep-copy whatever they still reference.
+ *
+ *           open() and saveAs() are also available as two phases, which allows file managers to move I/O out of the GUI
+ *           thread:
+ *           - @ref readFile reads and parses the file, and @ref completeOpen applies the new file info afterwards;
+ *           - @ref prepareSave serializes the data into a @ref SaveJob, and @ref completeSave applies the new file info
+ *             after the job succeeded.
+ *
+ *           @ref readFile and @ref SaveJob may be executed on a worker thread. @ref completeOpen, @ref prepareSave and
+ *           @ref completeSave must be called on the thread of this object. */
 
 class AbstractFile : public QObject
 {
     Q_OBJECT
 public:
+    /*! @brief Self-contained job writing serialized data to the disk. Does not reference the AbstractFile object which
+     *         created it, so it may be executed on any thread, even after that object was deleted. */
+    using SaveJob = std::function<std::expected<void,QString>()>;
+
     explicit AbstractFile(QObject* parent = nullptr);
-    virtual ~AbstractFile() = default;
+    ~AbstractFile() override;
 
     std::expected<void,QString> open(const QString& filePath);
     std::expected<void,QString> open(const QFileInfo& fileInfo);
@@ -61,6 +106,40 @@ public:
     std::expected<void,QString> saveAs(const QString& filePath);
     std::expected<void,QString> saveAs(const QFileInfo& fileInfo);
 
+///@name Two-phase open and save
+///@{
+    /*! @brief Reads and parses the file without changing @ref fileInfo or unsaved data state and without emitting
+     *         signals (except @ref loadProgressChanged). May be executed on a worker thread, as long as no other thread
+     *         accesses this object meanwhile. On success @ref completeOpen must be called on the thread of this object. */
+    std::expected<void,QString> readFile(const QFileInfo& fileInfo);
+
+    /*! @brief Makes @p fileInfo current and clears unsaved data state after successful @ref readFile. */
+    void completeOpen(const QFileInfo& fileInfo);
+
+    /*! @brief Serializes current data and returns job writing it to the @p fileInfo. If this object is saved over its
+     *         memory-mapped file, the mapping is released here. */
+    SaveJob prepareSave(const QFileInfo& fileInfo);
+
+    /*! @brief Makes @p fileInfo current and clears unsaved data state after the job from @ref prepareSave succeeded. */
+    void completeSave(const QFileInfo& fileInfo);
+
+    /*! @brief Requests cancellation of the running @ref readFile. Reading stops before the next chunk and @ref readFile
+     *         returns an error. Only chunked and memory-mapped loads can be interrupted. Thread-safe. */
+    void cancelLoading() { m_loadingCancelled.store(true, std::memory_order_relaxed); }
+///@}
+
+    /*! @brief Sets sync policy used by saving. Defaults to FileSyncPolicy::Full. Batch jobs which can be repeated after a
+     *         crash may use FileSyncPolicy::None to skip syncing. */
+    void setSyncPolicy(FileSyncPolicy syncPolicy) { m_syncPolicy = syncPolicy; }
+
+    /*! @brief Returns sync policy used by saving. */
+    FileSyncPolicy syncPolicy() const { return m_syncPolicy; }
+
+    /*! @brief Returns approximate amount of memory (in bytes) occupied by the data of this file. Used by file managers
+     *         keeping several files in memory. Default implementation returns size of the file on disk, derived classes
+     *         may override it with a more precise estimation. */
+    virtual qint64 estimatedMemoryUsage() const { return isUntitled() ? 0 : QFileInfo{m_currentFileInfo.absoluteFilePath()}.size(); }
+
     /*! @brief Returns true if the data within this @ref AbstractFile was not saved. */
     bool hasUnsavedData() const { return m_hasUnsavedData; }
 
@@ -83,21 +162,83 @@ signals:
     void unsavedDataStatusChanged(bool status);
     void fileInfoChanged(const QFileInfo& fileInfo);
 
+    /*! @brief Emitted after every chunk of a chunked or memory-mapped load. May be emitted from the thread executing
+     *         @ref readFile. */
+    void loadProgressChanged(qint64 bytesProcessed, qint64 bytesTotal);
+
 protected:
     void setUnsavedData(bool state);
     void setCurrentFileInfo(const QFileInfo& fileInfo);
 
     virtual QIODevice::OpenMode extraFlags() const { return {}; }
-    virtual std::expected<void,QString> dataProcessed(const QByteArray& bytes) = 0;
+
+///@name Memory mapping
+///@{
+    /*! @brief Should return `true` if file should be memory-mapped instead of being read into a buffer. Mapped data is
+     *         passed as is, so QIODevice::Text translation from @ref extraFlags is not applied to it. Empty files and files
+     *         which can not be mapped are read as usual. Default implementation returns `false`. */
+    virtual bool isMemoryMappingEnabled() const { return false; }
+
+    /*! @brief Called before the memory mapping is released while this object is saved over the mapped file. Derived
+     *         classes keeping references to the mapped data must deep-copy it here. Default implementation does nothing. */
+    virtual void mappedDataAboutToBeReleased() {}
+///@}
+
+    /*! @brief Called with the whole file contents when @ref loadChunkSize returns 0. Default implementation passes
+     *         @p bytes as a single chunk through @ref chunkedLoadStarted, @ref dataChunkProcessed and @ref finish. */
+    virtual std::expected<void,QString> dataProcessed(const QByteArray& bytes);
+
     virtual QByteArray currentData() const = 0;
 
+///@name Chunked loading
+///@{
+    /*! @brief Should return size (in bytes) of a single read when loading the file in chunks. Default implementation
+     *         returns 0, which means that whole file is read at once and passed to @ref dataProcessed. Files larger than
+     *         a single QByteArray can hold (2 GiB with Qt 5) fail to load at once and require chunked loading; chunk size
+     *         is capped to that limit as well. */
+    virtual qint64 loadChunkSize() const { return 0; }
+
+    /*! @brief Called before the first chunk is passed. @p totalSize is the size of the file on disk. Default
+     *         implementation does nothing. */
+    virtual std::expected<void,QString> chunkedLoadStarted(qint64 totalSize) { Q_UNUSED(totalSize); return {}; }
+
+    /*! @brief Called for every chunk read from the file. Data of @p chunk refers to the internal read buffer and remains
+     *         valid only until this method returns, so it must be deep-copied if needed later. Default implementation
+     *         returns an error. */
+    virtual std::expected<void,QString> dataChunkProcessed(const QByteArray& chunk);
+
+    /*! @brief Called after the last chunk was passed. Default implementation does nothing. */
+    virtual std::expected<void,QString> finish() { return {}; }
+///@}
+
 private:
     std::expected<void,QString> _fileDataLoaded(const QFileInfo& fileInfo);
+    std::expected<void,QString> _fileDataStreamed(QFile& file, qint64 chunkSize, ContentHasher& hasher);
+    std::expected<void,QString> _mappedDataStreamed(const char* data, qint64 size, qint64 chunkSize);
+    std::expected<void,QString> _checkCancelled() const;
+    void _releaseMappedFile();
+    void _rememberDiskState(const QFileInfo& fileInfo, quint64 contentHash);
+    bool _isDiskContentUnchanged(const QString& filePath) const;
+    std::optional<quint64> _diskContentHash(const QString& filePath) const;
     void _onFileChanged(const QString& filePath);
 
+    /*! @brief State of the file on disk as it was last loaded or saved by this object. */
+    struct DiskState
+    {
+        quint64 contentHash = 0;
+        qint64 size = -1;
+    };
+
     bool m_hasUnsavedData;
     QFileInfo m_currentFileInfo;
-    QFileSystemWatcher m_filesystemWatcher;
+    QFile* p_mappedFile;
+    std::atomic<bool> m_loadingCancelled;
+    FileSyncPolicy m_syncPolicy;
+    std::optional<DiskState> m_diskState;
+    std::optional<quint64> m_loadedContentHash;   ///< Set by readFile, applied by completeOpen.
+    std::optional<quint64> m_savedContentHash;    ///< Set by prepareSave, applied by completeSave.
+
+    friend class FileWatcherService;
 };
 
 };
@@ -0,0 +1,110 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef ABSTRACTSTREAMINGJSONFILE_H
+#define ABSTRACTSTREAMINGJSONFILE_H
+
+#include "draupnir/files/file_types/AbstractTextFile.h"
+
+#include "draupnir/files/core/JsonStreamReader.h"
+#include "draupnir/files/core/JsonStreamWriter.h"
+
+namespace Draupnir::Files
+{
+
+/*! @class AbstractStreamingJsonFile draupnir/files/file_types/AbstractStreamingJsonFile.h
+ *  @ingroup Files
+ *  @brief Base class for JSON files which are too large to be handled through QJsonDocument.
+ *
+ *  @details Unlike @ref Draupnir::Files::AbstractJsonFile, no document object model is built. File is read in chunks of
+ *           @ref loadChunkSize bytes and parsed by @ref Draupnir::Files::JsonStreamReader, which reports the document
+ *           through JsonStreamHandler methods implemented by derived classes. Derived classes may therefore populate
+ *           their own compact data structures directly.
+ *
+ *           As with any chunked file, loading may fail in the middle of the document. Derived classes should collect
+ *           parsed data aside in @ref jsonLoadStarted and the event methods, and apply it only in @ref jsonLoadFinished.
+ *
+ *           On save @ref writeJson is called to write the document element by element with
+ *           @ref Draupnir::Files::JsonStreamWriter. */
+
+class AbstractStreamingJsonFile : public AbstractTextFile, protected JsonStreamHandler
+{
+public:
+    /*! @brief Default value returned by @ref loadChunkSize. */
+    static constexpr qint64 defaultJsonChunkSize = 1024 * 1024;
+
+    explicit AbstractStreamingJsonFile(QObject* parent = nullptr) :
+        AbstractTextFile{parent},
+        m_reader{this}
+    {}
+    ~AbstractStreamingJsonFile() override = default;
+
+protected:
+    qint64 loadChunkSize() const override { return defaultJsonChunkSize; }
+
+    std::expected<void,QString> chunkedLoadStarted(qint64 totalSize) override {
+        m_reader.reset();
+        return jsonLoadStarted(totalSize);
+    }
+
+    std::expected<void,QString> dataChunkProcessed(const QByteArray& chunk) override {
+        return m_reader.addData(chunk);
+    }
+
+    std::expected<void,QString> finish() override {
+        const auto result = m_reader.finish();
+        if (!result)
+            return result;
+
+        return jsonLoadFinished();
+    }
+
+    QByteArray currentData() const override {
+        QByteArray output;
+        JsonStreamWriter writer{&output, jsonFormat()};
+        writeJson(writer);
+        return output;
+    }
+
+    /*! @brief Called before parsing of the document starts. @p totalSize is the size of the file on disk. Default
+     *         implementation does nothing. */
+    virtual std::expected<void,QString> jsonLoadStarted(qint64 totalSize) { Q_UNUSED(totalSize); return {}; }
+
+    /*! @brief Called after the whole document was parsed successfully. */
+    virtual std::expected<void,QString> jsonLoadFinished() = 0;
+
+    /*! @brief Should write the whole document with @p writer. */
+    virtual void writeJson(JsonStreamWriter& writer) const = 0;
+
+    /*! @brief Returns format of the saved document. Default implementation returns QJsonDocument::Indented, same as
+     *         @ref Draupnir::Files::AbstractJsonFile. */
+    virtual QJsonDocument::JsonFormat jsonFormat() const { return QJsonDocument::Indented; }
+
+private:
+    JsonStreamReader m_reader;
+};
+
+}; // namespace Draupnir::Files
+
+#endif // ABSTRACTSTREAMINGJSONFILE_H
@@ -45,7 +45,6 @@ public:
 protected:
     QIODevice::OpenMode extraFlags() const override { return QIODevice::Text; }
 
-    virtual std::expected<void,QString> dataProcessed(const QByteArray& bytes) override = 0;
     virtual QByteArray currentData() const override = 0;
 };
 
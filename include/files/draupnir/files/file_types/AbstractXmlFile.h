@@ -1,42 +1,192 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
 #ifndef ABSTRACTXMLFILE_H
 #define ABSTRACTXMLFILE_H
 
 #include "draupnir/files/file_types/AbstractTextFile.h"
 
-#include <QtXml/QDomDocument>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 namespace Draupnir::Files
 {
 
 /*! @class AbstractXmlFile draupnir/files/file_types/AbstractXmlFile.h
  *  @ingroup Files
- *  @brief This is a class. */
+ *  @brief Base class for XML files, parsed incrementally with QXmlStreamReader and written with QXmlStreamWriter.
+ *
+ *  @details No QDomDocument is built, so files of hundreds of megabytes can be handled. File is read in chunks of
+ *           @ref loadChunkSize bytes, which are passed to QXmlStreamReader. Each token is reported to derived classes
+ *           by @ref xmlElementStarted, @ref xmlElementFinished, @ref xmlCharactersParsed and @ref xmlTokenParsed. The
+ *           reader passed to these methods must not be advanced; it should only be used to access the current token
+ *           (name, attributes, text, etc.). Text of an element may be reported by several consecutive
+ *           @ref xmlCharactersParsed calls, as it may be split between chunks.
+ *
+ *           As with any chunked file, loading may fail in the middle of the document. Derived classes should collect
+ *           parsed data aside in @ref xmlLoadStarted and the token methods, and apply it only in @ref xmlLoadFinished.
+ *
+ *           On save the XML declaration is written and @ref writeXml is called to write the document contents. */
 
 class AbstractXmlFile : public AbstractTextFile
 {
 public:
+    /*! @brief Default value returned by @ref loadChunkSize. */
+    static constexpr qint64 defaultXmlChunkSize = 1024 * 1024;
+
     explicit AbstractXmlFile(QObject* parent = nullptr) :
-        AbstractTextFile{parent}
+        AbstractTextFile{parent},
+        m_endOfDocumentReached{false}
     {}
     ~AbstractXmlFile() override = default;
+
 protected:
-    std::expected<void,QString> dataProcessed(const QByteArray& bytes) override {
-        QDomDocument jsonDocument{QDomDocument((bytes,&jsonError)};
+    qint64 loadChunkSize() const override { return defaultXmlChunkSize; }
 
-        if (jsonError.error != QJsonParseError::NoError) {
-            return std::unexpected{jsonError.errorString()};
-        }
+    std::expected<void,QString> chunkedLoadStarted(qint64 totalSize) override {
+        m_reader.clear();
+        m_endOfDocumentReached = false;
+        return xmlLoadStarted(totalSize);
+    }
 
-        return jsonDocumentParsed(jsonDocument);
+    std::expected<void,QString> dataChunkProcessed(const QByteArray& chunk) override {
+        // Chunk refers to the read buffer of AbstractFile, so reader gets its own copy. Reader reports the end of
+        // document as soon as it runs out of data after the root element, but resumes when more data is added, so
+        // comments and processing instructions following the root element in later chunks are parsed as well.
+        m_reader.addData(QByteArray{chunk.constData(), chunk.size()});
+        return _readAvailableTokens();
     }
 
-    virtual std::expected<void,QString> jsonDocumentParsed(const QJsonDocument&) = 0;
+    std::expected<void,QString> finish() override {
+        if (!m_endOfDocumentReached) {
+            return std::unexpected{m_reader.hasError()
+                ? _errorString()
+                : QObject::tr("Invalid XML: unexpected end of document.")};
+        }
+
+        return xmlLoadFinished();
+    }
 
     QByteArray currentData() const override {
-        return currentJsonDocument().toJson();
+        QByteArray output;
+        QXmlStreamWriter writer{&output};
+        writer.setAutoFormatting(xmlAutoFormatting());
+        writer.writeStartDocument();
+        writeXml(writer);
+        writer.writeEndDocument();
+        return output;
+    }
+
+    /*! @brief Called before parsing of the document starts. @p totalSize is the size of the file on disk. Default
+     *         implementation does nothing. */
+    virtual std::expected<void,QString> xmlLoadStarted(qint64 totalSize) { Q_UNUSED(totalSize); return {}; }
+
+    /*! @brief Called for every start element. */
+    virtual std::expected<void,QString> xmlElementStarted(const QXmlStreamReader& reader) = 0;
+
+    /*! @brief Called for every end element. */
+    virtual std::expected<void,QString> xmlElementFinished(const QXmlStreamReader& reader) = 0;
+
+    /*! @brief Called for text and CDATA sections. Default implementation ignores them. */
+    virtual std::expected<void,QString> xmlCharactersParsed(const QXmlStreamReader& reader) { Q_UNUSED(reader); return {}; }
+
+    /*! @brief Called for remaining tokens: comments, processing instructions, DTD and entity references. Default
+     *         implementation ignores them. */
+    virtual std::expected<void,QString> xmlTokenParsed(const QXmlStreamReader& reader) { Q_UNUSED(reader); return {}; }
+
+    /*! @brief Called after the whole document was parsed successfully. */
+    virtual std::expected<void,QString> xmlLoadFinished() = 0;
+
+    /*! @brief Should write the document contents (root element) with @p writer. XML declaration is written by this
+     *         class. */
+    virtual void writeXml(QXmlStreamWriter& writer) const = 0;
+
+    /*! @brief Returns whether the saved document is indented. Default implementation returns `true`. */
+    virtual bool xmlAutoFormatting() const { return true; }
+
+private:
+    QXmlStreamReader m_reader;
+    bool m_endOfDocumentReached;
+
+    std::expected<void,QString> _readAvailableTokens() {
+        while (!m_reader.atEnd()) {
+            std::expected<void,QString> result;
+            switch (m_reader.readNext()) {
+            case QXmlStreamReader::Invalid:
+                // Rest of the document is in the next chunks. This may also be a comment or processing instruction
+                // following the root element, so the document is not complete until it is finished.
+                if (m_reader.error() == QXmlStreamReader::PrematureEndOfDocumentError) {
+                    m_endOfDocumentReached = false;
+                    return {};
+                }
+                return std::unexpected{_errorString()};
+            case QXmlStreamReader::StartDocument:
+                break;
+            case QXmlStreamReader::EndDocument:
+                m_endOfDocumentReached = true;
+                break;
+            case QXmlStreamReader::StartElement:
+                // Second root element in a resumed reader.
+                if (m_endOfDocumentReached)
+                    return std::unexpected{_extraContentError()};
+                result = xmlElementStarted(m_reader);
+                break;
+            case QXmlStreamReader::EndElement:
+                result = xmlElementFinished(m_reader);
+                break;
+            case QXmlStreamReader::Characters:
+                // Only whitespace may follow the root element.
+                if (m_endOfDocumentReached) {
+                    if (!m_reader.isWhitespace())
+                        return std::unexpected{_extraContentError()};
+                    break;
+                }
+                result = xmlCharactersParsed(m_reader);
+                break;
+            default:
+                result = xmlTokenParsed(m_reader);
+                break;
+            }
+
+            if (!result)
+                return result;
+        }
+        return {};
     }
 
-    virtual QJsonDocument currentJsonDocument() const = 0;
+    QString _extraContentError() const {
+        return QObject::tr("Invalid XML at line %1, column %2: extra content at end of document.")
+            .arg(m_reader.lineNumber())
+            .arg(m_reader.columnNumber());
+    }
+
+    QString _errorString() const {
+        return QObject::tr("Invalid XML at line %1, column %2: %3")
+            .arg(m_reader.lineNumber())
+            .arg(m_reader.columnNumber())
+            .arg(m_reader.errorString());
+    }
 };
 
 }; // namespace Draupnir::Files
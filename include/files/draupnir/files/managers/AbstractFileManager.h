@@ -60,6 +60,33 @@ signals:
      *  @param fileInfo New file information.
      * @todo Question: Is this signal usefull? */
     void currentFileInfoChanged(const QFileInfo&);
+
+    /*! @brief Emitted when a file kept in memory by a multi-file manager is dropped to stay within its budget, or because
+     *         it was changed on disk. Such file will be read from disk again when opened next time.
+     *  @param fileInfo Information about the dropped file. */
+    void fileEvicted(const QFileInfo& fileInfo);
+
+    /*! @brief Emitted while asynchronous open operation reads the file.
+     *  @param bytesProcessed Amount of bytes processed so far.
+     *  @param bytesTotal File size. */
+    void asyncOperationProgressChanged(qint64 bytesProcessed, qint64 bytesTotal);
+
+    /*! @brief Emitted when asynchronous open operation is finished, failed or cancelled.
+     *  @param success `true` if the file was opened and became the current file.
+     *  @param errorString Error description if `success` is `false`. */
+    void asyncOpenFinished(bool success, const QString& errorString);
+
+    /*! @brief Emitted by asynchronous bulk open operation of a multi-file manager for every distinct file, once it became
+     *         resident or failed to open.
+     *  @param fileInfo Information about the file.
+     *  @param success `true` if the file is resident.
+     *  @param errorString Error description if `success` is `false`. */
+    void asyncFileOpened(const QFileInfo& fileInfo, bool success, const QString& errorString);
+
+    /*! @brief Emitted when asynchronous save operation is finished, failed or cancelled.
+     *  @param success `true` if the file was saved.
+     *  @param errorString Error description if `success` is `false`. */
+    void asyncSaveFinished(bool success, const QString& errorString);
 };
 
 }; // namespace Draupnir::Files
@@ -0,0 +1,654 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef MULTIFILEMANAGERTEMPLATE_H
+#define MULTIFILEMANAGERTEMPLATE_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QStringList>
+#include <QThread>
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "draupnir/files/concepts/FileConcept.h"
+#include "draupnir/files/core/ParallelFileReader.h"
+#include "draupnir/files/managers/AbstractFileManager.h"
+
+namespace Draupnir::Files
+{
+
+/*! @class MultiFileManagerTemplate draupnir/files/managers/MultiFileManagerTemplate.h
+ *  @ingroup Files
+ *  @brief File manager implementation keeping several parsed files in memory.
+ *  @tparam FileClass File type managed by this class. Must satisfy @ref AbstractFileBased.
+ *
+ *  @details One of the resident files is the current one. Opening a file which is already resident only makes it current,
+ *           so switching between recently used documents does not read and parse them again.
+ *
+ *           Amount of resident files is limited by @ref maximumFileCount and by @ref memoryBudget (sum of
+ *           AbstractFile::estimatedMemoryUsage of resident files). When a limit is exceeded, least recently used files are
+ *           deleted and AbstractFileManager::fileEvicted is emitted for them. The current file, untitled files and files with
+ *           unsaved data are never evicted, so the limits may be exceeded temporarily.
+ *
+ *           Resident file which is not current and has no unsaved data is evicted as soon as it changes on disk, so a stale
+ *           copy is never returned.
+ *
+ *           Several files can be opened at once with @ref openFiles. They are read and parsed concurrently on up to
+ *           @ref bulkOpenThreadCount worker threads by @ref Draupnir::Files::ParallelFileReader. @ref openFiles blocks the
+ *           calling thread until all files are read, while @ref openFilesAsync returns immediately and reports results by
+ *           AbstractFileManager::asyncFileOpened and AbstractFileManager::asyncOpenFinished signals. Only one asynchronous
+ *           operation may run at a time.
+ *
+ *           Closed and evicted files are deleted with QObject::deleteLater. */
+
+template<AbstractFileBased FileClass>
+class MultiFileManagerTemplate : public AbstractFileManager
+{
+public:
+    /*! @brief Returns whether this manager can open multiple files at once.
+     *  @return Always `true`.
+     * @note This method is used by file menu entry handlers. */
+    static constexpr bool canOpenMultipleFilesAtOnce() { return true; }
+
+    /*! @brief Returns whether this manager can keep multiple files open simultaneously.
+     *  @return Always `true`.
+     * @note This method is used by file menu entry handlers. */
+    static constexpr bool canHaveMultipleFilesOpened() { return true; }
+
+    /*! @brief Default value of @ref maximumFileCount. */
+    static constexpr int defaultMaximumFileCount = 8;
+
+    /*! @brief Handler receiving result of opening a single file by @ref openFiles. */
+    using BulkOpenHandler = std::function<void(const QFileInfo& fileInfo, const std::expected<void,QString>& result)>;
+
+    /*! @brief Constructs an empty manager. */
+    explicit MultiFileManagerTemplate(QObject* parent = nullptr) :
+        AbstractFileManager{parent},
+        p_currentFile{nullptr},
+        m_maximumFileCount{defaultMaximumFileCount},
+        m_memoryBudget{0},
+        m_bulkOpenThreadCount{qMax(1, QThread::idealThreadCount())},
+        p_workerThread{nullptr},
+        m_cancelRequested{false}
+    {}
+
+    /*! @brief Destroys the manager and deletes all resident files. Running asynchronous operation is cancelled and waited
+     *         for. */
+    ~MultiFileManagerTemplate() {
+        if (p_workerThread) {
+            cancelAsyncOperation();
+            p_workerThread->wait();
+            delete p_workerThread;
+        }
+        qDeleteAll(m_pendingFiles);
+        qDeleteAll(m_files);
+    }
+
+    /*! @brief Sets maximal amount of resident files. Values lower than 1 are treated as 1. Evicts files if needed. */
+    void setMaximumFileCount(int count) {
+        m_maximumFileCount = qMax(1, count);
+        _evictOverBudget();
+    }
+
+    /*! @brief Returns maximal amount of resident files. */
+    int maximumFileCount() const { return m_maximumFileCount; }
+
+    /*! @brief Sets maximal memory (in bytes) occupied by resident files. 0 (default) means no limit. Evicts files if needed. */
+    void setMemoryBudget(qint64 bytes) {
+        m_memoryBudget = qMax<qint64>(0, bytes);
+        _evictOverBudget();
+    }
+
+    /*! @brief Returns maximal memory (in bytes) occupied by resident files. 0 means no limit. */
+    qint64 memoryBudget() const { return m_memoryBudget; }
+
+    /*! @brief Sets maximal amount of worker threads used by @ref openFiles. Values lower than 1 are treated as 1. */
+    void setBulkOpenThreadCount(int count) { m_bulkOpenThreadCount = qMax(1, count); }
+
+    /*! @brief Returns maximal amount of worker threads used by @ref openFiles. Defaults to QThread::idealThreadCount(). */
+    int bulkOpenThreadCount() const { return m_bulkOpenThreadCount; }
+
+    /*! @brief Creates a new untitled file object and makes it the current file. */
+    void newFile() {
+        _insertFile(new FileClass);
+    }
+
+    /*! @brief Makes file under @p fileInfo the current one. If it is resident, it is not read from disk again. Otherwise it
+     *         is opened and added to the resident files. If opening fails, the current file remains unchanged.
+     *  @param fileInfo Information about the file to open.
+     *  @return Empty result on success or an error message on failure. */
+    std::expected<void,QString> openFile(const QFileInfo& fileInfo) {
+        if (FileClass* residentFile = m_filesByPath.value(fileInfo.absoluteFilePath(), nullptr)) {
+            _touch(residentFile);
+            _setCurrentFile(residentFile);
+            return {};
+        }
+
+        FileClass* maybeNewFile = new FileClass;
+        auto openResult = maybeNewFile->open(fileInfo);
+        if (!openResult.has_value()) {
+            delete maybeNewFile;
+            return openResult;
+        }
+
+        _insertFile(maybeNewFile);
+        return {};
+    }
+
+    /*! @brief Overload of @ref openFile accepting file path. */
+    std::expected<void,QString> openFile(const QString& filePath) {
+        return openFile(QFileInfo{filePath});
+    }
+
+    /*! @brief Opens several files at once. Files which are not resident are read and parsed concurrently, each into its own
+     *         file object, and become resident as soon as they are read. Blocks until all files are processed.
+     *  @param fileInfos Files to open. Resident files and duplicates are not read again.
+     *  @param order Order in which @p handler is invoked.
+     *  @param handler Optional handler invoked on the calling thread for each of @p fileInfos, after the file became
+     *         resident or failed to open.
+     *  @return Per-file results in the order of @p fileInfos.
+     *  @note The last of @p fileInfos which is resident after the call becomes current. If more files are opened than
+     *        the limits allow, files opened earlier may already be evicted when this method returns. */
+    QList<std::expected<void,QString>> openFiles(const QList<QFileInfo>& fileInfos, ResultOrder order = ResultOrder::InOrder,
+                                                 const BulkOpenHandler& handler = {}) {
+        const int count = fileInfos.size();
+        std::vector<std::optional<std::expected<void,QString>>> results(count);
+
+        // Every file which is not resident is read once, by its own job.
+        QList<AbstractFile*> jobFiles;
+        QList<QFileInfo> jobFileInfos;
+        QList<QList<int>> jobInputs;
+        QHash<QString,int> jobsByPath;
+        for (int index = 0; index < count; index++) {
+            const QString filePath = fileInfos.at(index).absoluteFilePath();
+            if (FileClass* residentFile = m_filesByPath.value(filePath, nullptr)) {
+                _touch(residentFile);
+                results[index] = std::expected<void,QString>{};
+                continue;
+            }
+
+            auto job = jobsByPath.constFind(filePath);
+            if (job == jobsByPath.constEnd()) {
+                job = jobsByPath.insert(filePath, jobFiles.size());
+                jobFiles.append(new FileClass);
+                jobFileInfos.append(fileInfos.at(index));
+                jobInputs.append(QList<int>{});
+            }
+            jobInputs[job.value()].append(index);
+        }
+
+        int nextInOrder = 0;
+        auto deliverReady = [&]() {
+            if (!handler || order != ResultOrder::InOrder)
+                return;
+            while (nextInOrder < count && results[nextInOrder].has_value()) {
+                handler(fileInfos.at(nextInOrder), results[nextInOrder].value());
+                nextInOrder++;
+            }
+        };
+
+        if (handler && order == ResultOrder::AsCompleted) {
+            for (int index = 0; index < count; index++) {
+                if (results[index].has_value())
+                    handler(fileInfos.at(index), results[index].value());
+            }
+        }
+        deliverReady();
+
+        ParallelFileReader reader;
+        reader.setMaxThreadCount(m_bulkOpenThreadCount);
+        reader.read(jobFiles, jobFileInfos, ResultOrder::AsCompleted, [&](int job, const ParallelFileReader::Result& result) {
+            FileClass* file = static_cast<FileClass*>(jobFiles.at(job));
+            if (result.has_value()) {
+                file->completeOpen(jobFileInfos.at(job));
+                _insertFile(file, false);
+            } else {
+                delete file;
+            }
+
+            for (const int index : jobInputs.at(job)) {
+                results[index] = result;
+                if (handler && order == ResultOrder::AsCompleted)
+                    handler(fileInfos.at(index), result);
+            }
+            deliverReady();
+        });
+
+        for (int index = count - 1; index >= 0; index--) {
+            if (FileClass* file = m_filesByPath.value(fileInfos.at(index).absoluteFilePath(), nullptr)) {
+                _touch(file);
+                _setCurrentFile(file);
+                break;
+            }
+        }
+
+        QList<std::expected<void,QString>> resultList;
+        resultList.reserve(count);
+        for (std::optional<std::expected<void,QString>>& result : results)
+            resultList.append(std::move(result.value()));
+        return resultList;
+    }
+
+    /*! @brief Overload of @ref openFiles accepting file paths. Used by file menu entry handlers. */
+    QList<std::expected<void,QString>> openFiles(const QStringList& filePaths, ResultOrder order = ResultOrder::InOrder,
+                                                 const BulkOpenHandler& handler = {}) {
+        QList<QFileInfo> fileInfos;
+        fileInfos.reserve(filePaths.size());
+        for (const QString& filePath : filePaths)
+            fileInfos.append(QFileInfo{filePath});
+        return openFiles(fileInfos, order, handler);
+    }
+
+    /*! @brief Starts opening several files and returns immediately. Files which are not resident are read and parsed
+     *         concurrently as by @ref openFiles, on a worker thread, and become resident on the thread of this manager as
+     *         soon as they are read. AbstractFileManager::asyncFileOpened is emitted for every distinct file in the order
+     *         of completion, then AbstractFileManager::asyncOpenFinished, which reports success only if all files were
+     *         opened. The last of @p fileInfos which is resident by then becomes current, unless the operation was
+     *         cancelled.
+     *  @param fileInfos Files to open. Resident files and duplicates are not read again.
+     *  @return `false` if another asynchronous operation is running; `true` otherwise. */
+    bool openFilesAsync(const QList<QFileInfo>& fileInfos) {
+        if (isAsyncOperationRunning())
+            return false;
+
+        m_cancelRequested = false;
+        m_asyncFileInfos = fileInfos;
+        m_asyncErrors.clear();
+
+        // Created here, so the file objects live on the thread of this manager. Worker threads only read into them.
+        QList<AbstractFile*> jobFiles;
+        QList<QFileInfo> jobFileInfos;
+        QSet<QString> filePaths;
+        for (const QFileInfo& fileInfo : fileInfos) {
+            const QString filePath = fileInfo.absoluteFilePath();
+            if (filePaths.contains(filePath))
+                continue;
+            filePaths.insert(filePath);
+
+            if (FileClass* residentFile = m_filesByPath.value(filePath, nullptr)) {
+                _touch(residentFile);
+                // Reported from the event loop, as the results of other files.
+                QMetaObject::invokeMethod(this, [this, fileInfo]() {
+                    emit asyncFileOpened(fileInfo, true, QString{});
+                }, Qt::QueuedConnection);
+                continue;
+            }
+
+            FileClass* file = new FileClass;
+            m_pendingFiles.append(file);
+            jobFiles.append(file);
+            jobFileInfos.append(fileInfo);
+        }
+
+        _startWorker([this, jobFiles, jobFileInfos, threadCount = m_bulkOpenThreadCount]() {
+            ParallelFileReader reader;
+            reader.setMaxThreadCount(threadCount);
+            reader.read(jobFiles, jobFileInfos, ResultOrder::AsCompleted,
+                [this, &jobFiles, &jobFileInfos](int job, const ParallelFileReader::Result& result) {
+                    FileClass* file = static_cast<FileClass*>(jobFiles.at(job));
+                    const QFileInfo fileInfo = jobFileInfos.at(job);
+                    QMetaObject::invokeMethod(this, [this, file, fileInfo, result]() {
+                        _onAsyncFileRead(file, fileInfo, result);
+                    }, Qt::QueuedConnection);
+                });
+
+            QMetaObject::invokeMethod(this, [this]() {
+                _onAsyncOpenFinished();
+            }, Qt::QueuedConnection);
+        });
+        return true;
+    }
+
+    /*! @brief Overload of @ref openFilesAsync accepting file paths. */
+    bool openFilesAsync(const QStringList& filePaths) {
+        QList<QFileInfo> fileInfos;
+        fileInfos.reserve(filePaths.size());
+        for (const QString& filePath : filePaths)
+            fileInfos.append(QFileInfo{filePath});
+        return openFilesAsync(fileInfos);
+    }
+
+    /*! @brief Requests cancellation of the running asynchronous operation. Files which are not resident yet are dropped
+     *         and AbstractFileManager::asyncOpenFinished is emitted with `success` set to `false` once the worker thread
+     *         has stopped. */
+    void cancelAsyncOperation() {
+        if (!isAsyncOperationRunning())
+            return;
+
+        m_cancelRequested = true;
+        for (FileClass* file : std::as_const(m_pendingFiles))
+            file->cancelLoading();
+    }
+
+    /*! @brief Returns `true` while asynchronous open operation is running. */
+    bool isAsyncOperationRunning() const { return p_workerThread != nullptr; }
+
+    /*! @brief Makes resident @p file the current one. */
+    void setCurrentFile(FileClass* file) {
+        Q_ASSERT_X(m_files.contains(file), "MultiFileManagerTemplate<FileClass>::setCurrentFile",
+            "Provided file is not managed by this manager.");
+
+        _touch(file);
+        _setCurrentFile(file);
+    }
+
+    /*! @brief Saves the current file. The current file must exist and must already have a file name.
+     *  @return Empty result on success or an error message on failure. */
+    std::expected<void,QString> saveCurrentFile() {
+        Q_ASSERT_X(currentFileHasName(), "MultiFileManagerTemplate<FileClass>::saveCurrentFile",
+            "This method should be called only if there is file opened and this file has a name.");
+
+        return p_currentFile->save();
+    }
+
+    /*! @brief Saves the current file under a new file path. */
+    std::expected<void,QString> saveCurrentFileAs(const QString& filePath) {
+        return saveCurrentFileAs(QFileInfo{filePath});
+    }
+
+    /*! @brief Saves the current file under a new file location. The current file must exist. Resident file previously
+     *         opened from this location is replaced, unless it has unsaved data.
+     *  @param fileInfo Target file information.
+     *  @return Empty result on success or an error message on failure. */
+    std::expected<void,QString> saveCurrentFileAs(const QFileInfo& fileInfo) {
+        Q_ASSERT_X(p_currentFile, "MultiFileManagerTemplate<FileClass>::saveCurrentFileAs",
+            "This method should be called only if there is file opened.");
+
+        FileClass* residentFile = m_filesByPath.value(fileInfo.absoluteFilePath(), nullptr);
+        if (residentFile && residentFile != p_currentFile && residentFile->hasUnsavedData())
+            return std::unexpected{QObject::tr("File %1 is opened and has unsaved changes.").arg(fileInfo.absoluteFilePath())};
+
+        const QString oldPath = p_currentFile->isUntitled() ? QString{} : p_currentFile->fileInfo().absoluteFilePath();
+        auto saveResult = p_currentFile->saveAs(fileInfo);
+        if (!saveResult.has_value())
+            return saveResult;
+
+        if (residentFile && residentFile != p_currentFile)
+            _removeFile(residentFile);
+
+        m_filesByPath.remove(oldPath);
+        m_filesByPath.insert(fileInfo.absoluteFilePath(), p_currentFile);
+        return {};
+    }
+
+    /*! @brief Closes the current file. Next most recently used file becomes current. */
+    void closeCurrentFile() {
+        Q_ASSERT_X(p_currentFile, "MultiFileManagerTemplate<FileClass>::closeCurrentFile",
+            "This method should be called only if there is file opened.");
+
+        closeFile(p_currentFile);
+    }
+
+    /*! @brief Closes resident @p file. If it is the current file, next most recently used file becomes current. */
+    void closeFile(FileClass* file) {
+        Q_ASSERT_X(m_files.contains(file), "MultiFileManagerTemplate<FileClass>::closeFile",
+            "Provided file is not managed by this manager.");
+
+        if (file == p_currentFile) {
+            // Current file is not necessarily the most recently used one: asynchronously opened files are inserted in
+            // front of it without becoming current.
+            FileClass* nextFile = nullptr;
+            for (FileClass* residentFile : std::as_const(m_files)) {
+                if (residentFile != file) {
+                    nextFile = residentFile;
+                    break;
+                }
+            }
+            _setCurrentFile(nextFile);
+        }
+
+        _removeFile(file);
+    }
+
+    /*! @brief Returns the current file, or `nullptr` if no file is open. */
+    FileClass* currentFile() { return p_currentFile; }
+
+    /*! @brief Returns resident files, most recently used first. */
+    const QList<FileClass*>& files() const { return m_files; }
+
+    /*! @brief Returns amount of resident files. */
+    int fileCount() const { return m_files.size(); }
+
+    /*! @brief Returns `true` if file under @p fileInfo is resident, so opening it does not touch the disk. */
+    bool isResident(const QFileInfo& fileInfo) const { return m_filesByPath.contains(fileInfo.absoluteFilePath()); }
+
+    /*! @brief Returns sum of AbstractFile::estimatedMemoryUsage of all resident files. */
+    qint64 estimatedMemoryUsage() const {
+        qint64 result = 0;
+        for (const FileClass* file : m_files)
+            result += file->estimatedMemoryUsage();
+        return result;
+    }
+
+    /*! @brief Returns whether the current file already has a file name. */
+    bool currentFileHasName() const {
+        return (p_currentFile)
+            ? !p_currentFile->isUntitled()
+            : false;
+    }
+
+    /*! @brief Returns `true` if any of the resident files contains unsaved data. */
+    bool hasUnsavedData() const {
+        for (const FileClass* file : m_files) {
+            if (file->hasUnsavedData())
+                return true;
+        }
+        return false;
+    }
+
+    /*! @brief Returns whether no file is currently managed. */
+    bool hasNothingOpened() const { return p_currentFile == nullptr; }
+
+    /*! @brief Returns file information for the current file, or an empty `QFileInfo` if no file is current. */
+    QFileInfo currentFileInfo() const {
+        return p_currentFile ? p_currentFile->fileInfo() : QFileInfo{};
+    }
+
+private:
+    FileClass* p_currentFile;
+    QList<FileClass*> m_files;                  ///< Resident files, most recently used first.
+    QHash<QString,FileClass*> m_filesByPath;    ///< Titled resident files by their absolute path.
+    int m_maximumFileCount;
+    qint64 m_memoryBudget;
+    int m_bulkOpenThreadCount;
+    QThread* p_workerThread;
+    std::atomic<bool> m_cancelRequested;
+    QList<FileClass*> m_pendingFiles;           ///< Files being read by the asynchronous open operation.
+    QList<QFileInfo> m_asyncFileInfos;          ///< Files requested from the asynchronous open operation.
+    QStringList m_asyncErrors;                  ///< Errors of the asynchronous open operation so far.
+
+    /*! @brief Starts worker thread executing @p work. */
+    template<class Callable>
+    void _startWorker(Callable&& work) {
+        Q_ASSERT(p_workerThread == nullptr);
+        p_workerThread = QThread::create(std::forward<Callable>(work));
+        p_workerThread->start();
+    }
+
+    /*! @brief Waits for the worker thread to stop and deletes it. Executed on the thread of this manager. */
+    void _finishWorker() {
+        p_workerThread->wait();
+        delete p_workerThread;
+        p_workerThread = nullptr;
+    }
+
+    /*! @brief Makes @p file, read by asynchronous open operation, resident. Executed on the thread of this manager. */
+    void _onAsyncFileRead(FileClass* file, const QFileInfo& fileInfo, const std::expected<void,QString>& result) {
+        m_pendingFiles.removeOne(file);
+
+        if (m_cancelRequested || !result) {
+            delete file;
+            const QString error = m_cancelRequested ? QObject::tr("Opening was cancelled.") : result.error();
+            m_asyncErrors.append(QString{"%1: %2"}.arg(fileInfo.absoluteFilePath(), error));
+            emit asyncFileOpened(fileInfo, false, error);
+            return;
+        }
+
+        // File may have been opened by openFile() meanwhile.
+        if (m_filesByPath.contains(fileInfo.absoluteFilePath())) {
+            delete file;
+        } else {
+            file->completeOpen(fileInfo);
+            _insertFile(file, false);
+        }
+        emit asyncFileOpened(fileInfo, true, QString{});
+    }
+
+    /*! @brief Finalizes asynchronous open operation. Executed on the thread of this manager. */
+    void _onAsyncOpenFinished() {
+        _finishWorker();
+
+        if (!m_cancelRequested) {
+            for (int index = m_asyncFileInfos.size() - 1; index >= 0; index--) {
+                if (FileClass* file = m_filesByPath.value(m_asyncFileInfos.at(index).absoluteFilePath(), nullptr)) {
+                    _touch(file);
+                    _setCurrentFile(file);
+                    break;
+                }
+            }
+        }
+        m_asyncFileInfos.clear();
+
+        const QStringList errors = std::exchange(m_asyncErrors, QStringList{});
+        if (m_cancelRequested)
+            emit asyncOpenFinished(false, QObject::tr("Opening was cancelled."));
+        else
+            emit asyncOpenFinished(errors.isEmpty(), errors.join('\n'));
+    }
+
+    /*! @brief Adds freshly created or opened file to the resident files as the most recently used one. Makes it current
+     *         if @p makeCurrent is `true`. */
+    void _insertFile(FileClass* file, bool makeCurrent = true) {
+        m_files.prepend(file);
+        if (!file->isUntitled())
+            m_filesByPath.insert(file->fileInfo().absoluteFilePath(), file);
+
+        connect(file, &AbstractFile::unsavedDataStatusChanged, this, [this](bool hasUnsavedData) {
+            // Saved file may now be evicted.
+            if (!hasUnsavedData)
+                _evictOverBudget();
+        });
+        connect(file, &AbstractFile::fileChangedOnDisk, this, [this, file]() {
+            _onResidentFileChangedOnDisk(file);
+        });
+        connect(file, &AbstractFile::fileRemovedFromDisk, this, [this, file]() {
+            _onResidentFileChangedOnDisk(file);
+        });
+
+        if (makeCurrent)
+            _setCurrentFile(file);
+        _evictOverBudget();
+    }
+
+    /*! @brief Moves @p file to the front of the LRU order. */
+    void _touch(FileClass* file) {
+        const int index = m_files.indexOf(file);
+        Q_ASSERT(index >= 0);
+        m_files.move(index, 0);
+    }
+
+    /*! @brief Removes resident @p file, which must not be the current one, and schedules its deletion. Deletion is
+     *         deferred, as files may be removed while they are emitting a signal. */
+    void _removeFile(FileClass* file) {
+        Q_ASSERT(file != p_currentFile);
+        m_files.removeOne(file);
+        if (!file->isUntitled() && m_filesByPath.value(file->fileInfo().absoluteFilePath()) == file)
+            m_filesByPath.remove(file->fileInfo().absoluteFilePath());
+
+        file->disconnect(this);
+        file->deleteLater();
+    }
+
+    /*! @brief Returns `true` if @p file may be dropped and read from disk again later. */
+    bool _isEvictable(const FileClass* file) const {
+        return file != p_currentFile && !file->isUntitled() && !file->hasUnsavedData();
+    }
+
+    /*! @brief Evicts least recently used evictable files while resident files exceed the count or memory budget. */
+    void _evictOverBudget() {
+        qint64 memoryUsage = (m_memoryBudget > 0) ? estimatedMemoryUsage() : 0;
+        for (int index = m_files.size() - 1; index >= 0; index--) {
+            const bool overBudget = m_files.size() > m_maximumFileCount || (m_memoryBudget > 0 && memoryUsage > m_memoryBudget);
+            if (!overBudget)
+                return;
+
+            FileClass* file = m_files.at(index);
+            if (!_isEvictable(file))
+                continue;
+
+            memoryUsage -= file->estimatedMemoryUsage();
+            _evict(file);
+        }
+    }
+
+    /*! @brief Deletes @p file and reports it by AbstractFileManager::fileEvicted. */
+    void _evict(FileClass* file) {
+        const QFileInfo fileInfo = file->fileInfo();
+        _removeFile(file);
+        emit fileEvicted(fileInfo);
+    }
+
+    /*! @brief Drops stale copy of a file changed on disk, unless it is current or has unsaved data. */
+    void _onResidentFileChangedOnDisk(FileClass* file) {
+        if (_isEvictable(file))
+            _evict(file);
+    }
+
+    /*! @brief Makes @p newCurrentFile (resident file or `nullptr`) the current one and emits manager signals. */
+    void _setCurrentFile(FileClass* newCurrentFile) {
+        if (p_currentFile == newCurrentFile)
+            return;
+
+        const QFileInfo oldFileInfo = currentFileInfo();
+        if (p_currentFile) {
+            disconnect(p_currentFile, &AbstractFile::fileInfoChanged,
+                       this, &AbstractFileManager::currentFileInfoChanged);
+        }
+
+        p_currentFile = newCurrentFile;
+        const QFileInfo newFileInfo = currentFileInfo();
+
+        if (p_currentFile) {
+            connect(p_currentFile, &AbstractFile::fileInfoChanged,
+                    this, &AbstractFileManager::currentFileInfoChanged);
+        }
+
+        if (p_currentFile == nullptr)
+            emit currentFileInfoChanged(QFileInfo{});
+        else if (oldFileInfo.absoluteFilePath() != newFileInfo.absoluteFilePath())
+            emit currentFileInfoChanged(newFileInfo);
+
+        emit currentAbstractFileChanged(p_currentFile);
+    }
+};
+
+} // namespace Draupnir::Files
+
+#endif // MULTIFILEMANAGERTEMPLATE_H
@@ -26,6 +26,10 @@
 #define SINGLEFILEMANAGERTEMPLATE_H
 
 #include <QDebug>
+#include <QPointer>
+#include <QThread>
+
+#include <atomic>
 
 #include "draupnir/files/concepts/FileConcept.h"
 #include "draupnir/files/managers/AbstractFileManager.h"
@@ -41,6 +45,20 @@ namespace Draupnir::Files
  *  @details This manager owns at most one file instance at a time. Opening or creating a new file replaces the currently
  *           managed file.
  *
+ *           Besides synchronous openFile() / saveCurrentFile() methods, asynchronous variants are provided. They execute
+ *           reading, parsing and writing on a worker thread and report results by AbstractFileManager::asyncOpenFinished
+ *           and AbstractFileManager::asyncSaveFinished signals. The current file is replaced only on the thread of this
+ *           manager and only after parsing succeeded. Only one asynchronous operation may run at a time.
+ *
+ *           Usage:
+ *           @code
+ *           connect(manager, &AbstractFileManager::asyncOperationProgressChanged, progressBar, [progressBar](qint64 done, qint64 total) {
+ *               progressBar->setValue(total > 0 ? static_cast<int>(done * 100 / total) : 0);
+ *           });
+ *           connect(manager, &AbstractFileManager::asyncOpenFinished, this, &MainWindow::onFileOpened);
+ *           manager->openFileAsync(fileInfo);
+ *           @endcode
+ *
  *  @todo Remove canOpenMultipleFilesAtOnce() and canHaveMultipleFilesOpened(). File menu handlers may use draupnir::utils::is_template_base_of
  *        to distinguish between single-file and multi-file manager implementations. */
 
@@ -61,11 +79,22 @@ public:
     /*! @brief Constructs an empty single-file manager. */
     explicit SingleFileManagerTemplate(QObject* parent = nullptr) :
         AbstractFileManager{parent},
-        p_currentFile{nullptr}
+        p_currentFile{nullptr},
+        p_pendingFile{nullptr},
+        p_workerThread{nullptr},
+        m_cancelRequested{false}
     {}
 
-    /*! @brief Destroys the manager and deletes the currently managed file, if any. */
+    /*! @brief Destroys the manager and deletes the currently managed file, if any. Running asynchronous operation is
+     *         cancelled and waited for. */
     ~SingleFileManagerTemplate() {
+        if (p_workerThread) {
+            cancelAsyncOperation();
+            p_workerThread->wait();
+            delete p_workerThread;
+        }
+        if (p_pendingFile)
+            delete p_pendingFile;
         if (p_currentFile)
             delete p_currentFile;
     }
@@ -119,6 +148,81 @@ public:
         return p_currentFile->saveAs(fileInfo);
     }
 
+    /*! @brief Starts opening a file on a worker thread. On success the previously managed file is deleted and replaced
+     *         on the thread of this manager. AbstractFileManager::asyncOpenFinished is emitted when done.
+     *  @param fileInfo Information about the file to open.
+     *  @return `false` if another asynchronous operation is running; `true` otherwise. */
+    bool openFileAsync(const QFileInfo& fileInfo) {
+        if (isAsyncOperationRunning())
+            return false;
+
+        // Created here, so the file object lives on the thread of this manager. Worker thread only reads into it.
+        FileClass* pendingFile = new FileClass;
+        p_pendingFile = pendingFile;
+        m_cancelRequested = false;
+        connect(pendingFile, &AbstractFile::loadProgressChanged,
+                this, &AbstractFileManager::asyncOperationProgressChanged);
+
+        _startWorker([this, pendingFile, fileInfo]() {
+            const std::expected<void,QString> result = pendingFile->readFile(fileInfo);
+            QMetaObject::invokeMethod(this, [this, fileInfo, result]() {
+                _onOpenFinished(fileInfo, result);
+            }, Qt::QueuedConnection);
+        });
+        return true;
+    }
+
+    /*! @brief Starts saving the current file on a worker thread. Data is serialized on the calling thread. The current
+     *         file must exist and must already have a file name.
+     *  @return `false` if another asynchronous operation is running; `true` otherwise. */
+    bool saveCurrentFileAsync() {
+        Q_ASSERT_X(currentFileHasName(), "SingleFileManagerTemplate<FileClass>::saveCurrentFileAsync",
+            "This method should be called only if there is file opened and this file has a name.");
+
+        return saveCurrentFileAsAsync(p_currentFile->fileInfo());
+    }
+
+    /*! @brief Starts saving the current file under a new file location on a worker thread. Data is serialized on the
+     *         calling thread. The current file must exist. Cancellation is possible only until writing has started.
+     *  @param fileInfo Target file information.
+     *  @return `false` if another asynchronous operation is running; `true` otherwise. */
+    bool saveCurrentFileAsAsync(const QFileInfo& fileInfo) {
+        Q_ASSERT_X(p_currentFile, "SingleFileManagerTemplate<FileClass>::saveCurrentFileAsAsync",
+            "This method should be called only if there is file opened.");
+
+        if (isAsyncOperationRunning())
+            return false;
+
+        m_cancelRequested = false;
+        const AbstractFile::SaveJob saveJob = p_currentFile->prepareSave(fileInfo);
+        // File may be closed or replaced while saving, so it is tracked by QPointer.
+        const QPointer<FileClass> savedFile{p_currentFile};
+
+        _startWorker([this, saveJob, savedFile, fileInfo]() {
+            const std::expected<void,QString> result = m_cancelRequested ?
+                std::expected<void,QString>{std::unexpect, QObject::tr("Saving was cancelled.")} :
+                saveJob();
+            QMetaObject::invokeMethod(this, [this, savedFile, fileInfo, result]() {
+                _onSaveFinished(savedFile, fileInfo, result);
+            }, Qt::QueuedConnection);
+        });
+        return true;
+    }
+
+    /*! @brief Requests cancellation of the running asynchronous operation. Corresponding finished signal is emitted with
+     *         `success` set to `false` once the worker thread has stopped. */
+    void cancelAsyncOperation() {
+        if (!isAsyncOperationRunning())
+            return;
+
+        m_cancelRequested = true;
+        if (p_pendingFile)
+            p_pendingFile->cancelLoading();
+    }
+
+    /*! @brief Returns `true` while asynchronous open or save operation is running. */
+    bool isAsyncOperationRunning() const { return p_workerThread != nullptr; }
+
     /*! @brief Closes the currently managed file. Deletes the current file object and clears the manager state. */
     void closeFile() {
         Q_ASSERT_X(p_currentFile, "SingleFileManagerTemplate<FileClass>::closeFile",
@@ -157,6 +261,58 @@ public:
 
 private:
     FileClass* p_currentFile;
+    FileClass* p_pendingFile;      ///< File being read by the asynchronous open operation.
+    QThread* p_workerThread;
+    std::atomic<bool> m_cancelRequested;
+
+    /*! @brief Starts worker thread executing @p work. */
+    template<class Callable>
+    void _startWorker(Callable&& work) {
+        Q_ASSERT(p_workerThread == nullptr);
+        p_workerThread = QThread::create(std::forward<Callable>(work));
+        p_workerThread->start();
+    }
+
+    /*! @brief Waits for the worker thread to stop and deletes it. Executed on the thread of this manager. */
+    void _finishWorker() {
+        p_workerThread->wait();
+        delete p_workerThread;
+        p_workerThread = nullptr;
+    }
+
+    /*! @brief Finalizes asynchronous open operation. Executed on the thread of this manager. */
+    void _onOpenFinished(const QFileInfo& fileInfo, const std::expected<void,QString>& result) {
+        _finishWorker();
+
+        FileClass* openedFile = p_pendingFile;
+        p_pendingFile = nullptr;
+
+        if (m_cancelRequested || !result) {
+            delete openedFile;
+            emit asyncOpenFinished(false, m_cancelRequested ? QObject::tr("Opening was cancelled.") : result.error());
+            return;
+        }
+
+        disconnect(openedFile, &AbstractFile::loadProgressChanged,
+                   this, &AbstractFileManager::asyncOperationProgressChanged);
+        openedFile->completeOpen(fileInfo);
+        _setCurrentFile(openedFile);
+        emit asyncOpenFinished(true, QString{});
+    }
+
+    /*! @brief Finalizes asynchronous save operation. Executed on the thread of this manager. */
+    void _onSaveFinished(const QPointer<FileClass>& savedFile, const QFileInfo& fileInfo, const std::expected<void,QString>& result) {
+        _finishWorker();
+
+        if (!result) {
+            emit asyncSaveFinished(false, result.error());
+            return;
+        }
+
+        if (savedFile)
+            savedFile->completeSave(fileInfo);
+        emit asyncSaveFinished(true, QString{});
+    }
 
     /*! @brief Replaces the currently managed file.
      *  @param newCurrentFile New file object, or `nullptr` to clear the current file.
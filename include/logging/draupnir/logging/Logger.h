@@ -26,12 +26,17 @@
 #define LOGGER_H
 
 #include <QObject>
+#include <QSharedPointer>
+
+#include <concepts>
 
 #ifndef DRAUPNIR_LOGGING_SINGLETHREAD
     #include <QMutex>
     #include <QMutexLocker>
 #endif // DRAUPNIR_LOGGING_SINGLETHREAD
 
+#include "draupnir/logging/core/MessageGroupBuffer.h"
+#include "draupnir/logging/core/MessageSampler.h"
 #include "draupnir/logging/messages/Message.h"
 #include "draupnir/logging/messages/MessageGroup.h"
 #include "draupnir/logging/messages/MessageLevels.h"
@@ -56,6 +61,11 @@ class AbstractMessageHandler;
  *           In the default multithreaded mode public logging methods are guarded internally and messages are delivered to
  *           the handler through Qt signals.
  *
+ *           Each message group keeps its messages in a lock-free @ref Draupnir::Logging::MessageGroupBuffer. Groups are
+ *           remembered by the thread which started them, so logging into a group from that thread neither locks the logger
+ *           mutex nor looks the group up in the shared group map. Logging into a group from any other thread falls back to a
+ *           synchronized lookup.
+ *
  * @todo Question: What to do if logging to non-existant group? Should we print something to debug? Or Q_ASSERT_X? -> or
  *       let user define this? */
 
@@ -131,6 +141,64 @@ public:
     void logMessage(Message* message, MessageGroup group);
 ///@}
 
+///@name This group of methods allows sampled logging from high-frequency call sites.
+///@{
+    /*! @brief Logs a message if `sampler` accepts it. The decision is made before the message is created, but after `what`
+     *         was evaluated by the caller - use the overload taking a callable if building the text is costly. If some
+     *         messages were suppressed since the previous accepted one, their amount is attached to the message as a field
+     *         with @ref Draupnir::Logging::MessageSampler::suppressedFieldKey.
+     *  @param sampler Sampler of the call site, usually a `thread_local` variable.
+     *  @param what Message text.
+     *  @param messageLevel Message severity level.
+     *  @param messageCategory Message category. */
+    void logSampled(MessageSampler& sampler, const QString& what, MessageLevel::Value messageLevel, MessageCategory messageCategory = MessageCategory::Default) {
+        if (const std::optional<quint64> suppressed = sampler.sample())
+            logMessage(Message::create(what, _suppressedFields(*suppressed), messageLevel, messageCategory));
+    }
+
+    /*! @brief Logs a message with brief and full text if `sampler` accepts it. See @ref logSampled for details.
+     *  @param sampler Sampler of the call site, usually a `thread_local` variable.
+     *  @param brief Short message summary.
+     *  @param what Full message text.
+     *  @param messageLevel Message severity level.
+     *  @param messageCategory Message category. */
+    void logSampled(MessageSampler& sampler, const QString& brief, const QString& what, MessageLevel::Value messageLevel, MessageCategory messageCategory = MessageCategory::Default) {
+        if (const std::optional<quint64> suppressed = sampler.sample())
+            logMessage(Message::create(brief, what, _suppressedFields(*suppressed), messageLevel, messageCategory));
+    }
+
+    /*! @brief Logs a message built by `makeWhat` if `sampler` accepts it. Unlike the overloads taking a `QString`, the text
+     *         is neither built nor formatted for suppressed messages, so this overload should be preferred when the text is
+     *         composed with `QString::arg` or similar.
+     *  @param sampler Sampler of the call site, usually a `thread_local` variable.
+     *  @param makeWhat Callable returning message text. Invoked only if the message is emitted.
+     *  @param messageLevel Message severity level.
+     *  @param messageCategory Message category. */
+    template<std::invocable MakeWhat>
+    void logSampled(MessageSampler& sampler, MakeWhat&& makeWhat, MessageLevel::Value messageLevel, MessageCategory messageCategory = MessageCategory::Default) {
+        if (const std::optional<quint64> suppressed = sampler.sample())
+            logMessage(Message::create(QString{std::forward<MakeWhat>(makeWhat)()}, _suppressedFields(*suppressed), messageLevel, messageCategory));
+    }
+
+    /*! @brief Logs a debug message if `sampler` accepts it.
+     *  @param sampler Sampler of the call site, usually a `thread_local` variable.
+     *  @param what Message content.
+     *  @param messageCategory Message category. */
+    void logDebug(MessageSampler& sampler, const QString& what, MessageCategory messageCategory = MessageCategory::Default) {
+        logSampled(sampler, what, MessageLevel::Debug, messageCategory);
+    }
+
+    /*! @brief Logs a debug message built by `makeWhat` if `sampler` accepts it. `makeWhat` is not invoked for suppressed
+     *         messages.
+     *  @param sampler Sampler of the call site, usually a `thread_local` variable.
+     *  @param makeWhat Callable returning message content.
+     *  @param messageCategory Message category. */
+    template<std::invocable MakeWhat>
+    void logDebug(MessageSampler& sampler, MakeWhat&& makeWhat, MessageCategory messageCategory = MessageCategory::Default) {
+        logSampled(sampler, std::forward<MakeWhat>(makeWhat), MessageLevel::Debug, messageCategory);
+    }
+///@}
+
 ///@name This group of methods allows logging the default levels of messages.
 ///@{
     /*! @brief Logs a message with the specified level and category.
@@ -331,9 +399,10 @@ private:
      *         transferred. */
     QList<Message*>* p_tempMessageStorage;
 
-    /*! @brief Stores messages associated with active message groups. The logger owns messages stored in this map until the
-     *         corresponding group is flushed or ended. */
-    QMap<MessageGroup,QList<Message*>> m_messageGroupsMap;
+    /*! @brief Stores buffers of active message groups. Messages stored within these buffers are owned by the logger until the
+     *         corresponding group is flushed or ended. Buffers are shared with the thread-local cache of the thread, which has
+     *         started the group. */
+    QMap<MessageGroup,QSharedPointer<MessageGroupBuffer>> m_messageGroupsMap;
 
     /*! @brief Message handler used to process submitted messages.
      * @note This pointer is non-owning. */
@@ -365,10 +434,23 @@ private:
 #endif // DRAUPNIR_LOGGING_SINGLETHREAD
 ///@}
 
-    /*! @brief Thread-unsafe implementation of @ref beginMessageGroup. */
-    MessageGroup _beginMessageGroupUnsafe();
+    /*! @brief Returns fields reporting amount of messages suppressed by a sampler, or empty fields if nothing was suppressed. */
+    static MessageFields _suppressedFields(quint64 suppressed) {
+        if (suppressed == 0)
+            return MessageFields{};
+        return MessageFields{{MessageSampler::suppressedFieldKey(), suppressed}};
+    }
+
+    /*! @brief Thread-unsafe implementation of @ref beginMessageGroup.
+     *  @param buffer Receives buffer created for the new group. */
+    MessageGroup _beginMessageGroupUnsafe(QSharedPointer<MessageGroupBuffer>& buffer);
 
-    bool _takeGroupMessagesForDeliveryUnsafe(MessageGroup group, bool removeGroup, MessageList& out);
+    /*! @brief Thread-unsafe part of @ref flush and @ref endMessageGroup. Detaches messages of the group in O(1). If message
+     *         handler is not yet installed, messages are moved to the temporary storage instead.
+     *  @param group Message group to take messages from.
+     *  @param removeGroup If `true` the group buffer is closed and the group is removed.
+     *  @return Detached chain of messages which should be delivered, or `nullptr` if there is nothing to deliver. */
+    Message* _takeGroupMessagesForDeliveryUnsafe(MessageGroup group, bool removeGroup);
 
     /*! @brief Thread-unsafe implementation of single message delivery.
      *  @param message Message to deliver.
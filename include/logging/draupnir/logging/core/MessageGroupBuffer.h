@@ -0,0 +1,149 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef MESSAGEGROUPBUFFER_H
+#define MESSAGEGROUPBUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "draupnir/logging/messages/Message.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageGroupBuffer draupnir/logging/core/MessageGroupBuffer.h
+ *  @ingroup Logging
+ *  @brief Lock-free append buffer holding messages of a single @ref Draupnir::Logging::MessageGroup.
+ *
+ *  @details Messages are linked through an intrusive pointer stored within @ref Draupnir::Logging::Message, so appending
+ *           a message is a single compare-and-swap on the buffer head and requires neither a mutex nor an allocation.
+ *           Buffered messages are detached as a whole with one atomic exchange (@ref takeChain / @ref closeChain) and are
+ *           converted into a @ref Draupnir::Logging::MessageList by @ref toMessageList afterwards, outside of any lock.
+ *
+ *           Once the buffer is closed every following @ref append call fails, so no message can get stranded in a buffer
+ *           of the group which was already ended.
+ *
+ *           The buffer owns messages linked into it. Remaining messages are deleted when the buffer is destroyed. */
+
+class MessageGroupBuffer final
+{
+    Q_DISABLE_COPY(MessageGroupBuffer);
+public:
+    /*! @brief Constructor. Creates an empty open buffer. */
+    MessageGroupBuffer() = default;
+
+    /*! @brief Destructor. Deletes messages which are still buffered. */
+    ~MessageGroupBuffer() { qDeleteAll(toMessageList(closeChain())); }
+
+    /*! @brief Appends message to this buffer. This method is lock-free and can be called from any thread.
+     *  @param message Message to append. Must not be `nullptr`.
+     *  @return `true` if the message was appended and ownership was transferred to the buffer; `false` if the buffer was
+     *          already closed. In the latter case ownership stays with the caller. */
+    bool append(Message* message) {
+        Q_ASSERT(message);
+        Message* head = m_head.load(std::memory_order_relaxed);
+        do {
+            if (head == _closedMarker())
+                return false;
+            message->p_nextInGroup = head;
+        } while (!m_head.compare_exchange_weak(head, message, std::memory_order_release, std::memory_order_relaxed));
+        return true;
+    }
+
+    /*! @brief Detaches all buffered messages, leaving the buffer open for further appends.
+     *  @return Head of the detached chain (most recently appended message first) or `nullptr` if nothing was buffered.
+     *          Ownership of the chain is transferred to the caller. */
+    Message* takeChain() {
+        Message* head = m_head.load(std::memory_order_acquire);
+        do {
+            if (head == nullptr || head == _closedMarker())
+                return nullptr;
+        } while (!m_head.compare_exchange_weak(head, nullptr, std::memory_order_acq_rel, std::memory_order_acquire));
+        return head;
+    }
+
+    /*! @brief Detaches all buffered messages and closes the buffer. Further @ref append calls will fail.
+     *  @return Head of the detached chain (most recently appended message first) or `nullptr` if nothing was buffered.
+     *          Ownership of the chain is transferred to the caller. */
+    Message* closeChain() {
+        Message* head = m_head.exchange(_closedMarker(), std::memory_order_acq_rel);
+        return (head == _closedMarker()) ? nullptr : head;
+    }
+
+    /*! @brief Returns `true` if this buffer was closed by @ref closeChain. */
+    bool isClosed() const { return m_head.load(std::memory_order_acquire) == _closedMarker(); }
+
+    /*! @brief Returns `true` if no messages are currently buffered. */
+    bool isEmpty() const {
+        Message* head = m_head.load(std::memory_order_acquire);
+        return head == nullptr || head == _closedMarker();
+    }
+
+    /*! @brief Returns amount of currently buffered messages.
+     * @note This method walks the chain and must not race with @ref takeChain / @ref closeChain. It is intended for
+     *       diagnostics and tests. */
+    int count() const {
+        int result = 0;
+        for (const Message* current = _head(); current != nullptr; current = current->p_nextInGroup)
+            result++;
+        return result;
+    }
+
+    /*! @brief Returns the most recently appended message or `nullptr` if the buffer is empty.
+     * @note The returned message is still owned by the buffer. */
+    Message* last() const { return _head(); }
+
+    /*! @brief Converts chain detached by @ref takeChain / @ref closeChain into a list ordered by append time.
+     *  @param chain Head of the detached chain. May be `nullptr`.
+     *  @return List of messages, oldest first. Ownership of the messages is transferred to the caller. */
+    static MessageList toMessageList(Message* chain) {
+        MessageList result;
+        while (chain != nullptr) {
+            Message* next = chain->p_nextInGroup;
+            chain->p_nextInGroup = nullptr;
+            result.append(chain);
+            chain = next;
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    std::atomic<Message*> m_head{nullptr};
+
+    /*! @brief Returns head of the chain or `nullptr` if buffer is empty or closed. */
+    Message* _head() const {
+        Message* head = m_head.load(std::memory_order_acquire);
+        return (head == _closedMarker()) ? nullptr : head;
+    }
+
+    /*! @brief Returns sentinel value stored within `m_head` after the buffer was closed. */
+    static Message* _closedMarker() { return reinterpret_cast<Message*>(std::uintptr_t{1}); }
+};
+
+}; // namespace Draupnir::Logging
+
+#endif // MESSAGEGROUPBUFFER_H
@@ -0,0 +1,142 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef MESSAGESAMPLER_H
+#define MESSAGESAMPLER_H
+
+#include <chrono>
+#include <optional>
+#include <utility>
+
+#include "draupnir/logging/messages/MessageFields.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageSampler draupnir/logging/core/MessageSampler.h
+ *  @ingroup Logging
+ *  @brief Decides which messages of a high-frequency call site are actually logged.
+ *
+ *  @details Sampler keeps plain counters and is meant to be declared as a `thread_local` variable at the call site, so each
+ *           call site gets its own state in every thread and the decision requires neither locking nor atomics. The decision
+ *           is made by @ref sample before any @ref Draupnir::Logging::Message is allocated. Amount of messages suppressed
+ *           since the previous emitted one is reported by @ref sample and is attached by @ref Draupnir::Logging::Logger to
+ *           the next emitted message as a field with @ref suppressedFieldKey.
+ *
+ *           Usage:
+ *           @code
+ *           for (const auto& item : items) {
+ *               thread_local MessageSampler sampler = MessageSampler::oneIn(1000);
+ *               logger.logDebug(sampler, "Processing item");
+ *               // Text is formatted only for emitted messages
+ *               logger.logDebug(sampler, [&item]() { return QString{"Processing %1"}.arg(item.name()); });
+ *               // ...
+ *           }
+ *           @endcode
+ *
+ * @note Limits are applied per thread: with @ref perSecond every thread executing the call site may emit up to the limit. */
+
+class MessageSampler final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /*! @brief Returns sampler emitting the first message and every `n`-th message afterwards.
+     *  @param n Sampling period. Must be greater than zero. */
+    static MessageSampler oneIn(quint32 n) {
+        Q_ASSERT_X(n > 0, "MessageSampler::oneIn", "Sampling period must be greater than zero.");
+        return MessageSampler{OneIn, n};
+    }
+
+    /*! @brief Returns sampler emitting at most `limit` messages per second.
+     *  @param limit Maximal amount of messages emitted within one second. */
+    static MessageSampler perSecond(quint32 limit) {
+        return MessageSampler{PerSecond, limit};
+    }
+
+    /*! @brief Decides whether the next message should be emitted.
+     *  @return `std::nullopt` if the message should be suppressed; otherwise amount of messages suppressed since the
+     *          previous emitted message. */
+    std::optional<quint64> sample() {
+        return (m_mode == PerSecond) ? sample(Clock::now()) : _emitIf(_sampleOneIn());
+    }
+
+    /*! @brief Overload of @ref sample using provided time instead of reading the clock. Time is only used by @ref perSecond
+     *         samplers. */
+    std::optional<quint64> sample(Clock::time_point now) {
+        if (m_mode == OneIn)
+            return _emitIf(_sampleOneIn());
+
+        if (now - m_windowStart >= std::chrono::seconds{1}) {
+            m_windowStart = now;
+            m_counter = 0;
+        }
+        return _emitIf(m_counter++ < m_limit);
+    }
+
+    /*! @brief Returns amount of messages suppressed since the previous emitted message. */
+    quint64 suppressedCount() const { return m_suppressed; }
+
+    /*! @brief Returns key of the @ref Draupnir::Logging::MessageFields entry holding amount of suppressed messages. */
+    static MessageFieldKey suppressedFieldKey() {
+        static const MessageFieldKey key = MessageFieldKey::intern("suppressed");
+        return key;
+    }
+
+private:
+    enum Mode : quint8 {
+        OneIn,
+        PerSecond
+    };
+
+    MessageSampler(Mode mode, quint32 limit) :
+        m_mode{mode},
+        m_limit{limit}
+    {}
+
+    Mode m_mode;
+    quint32 m_limit;
+    quint32 m_counter = 0;
+    quint64 m_suppressed = 0;
+    Clock::time_point m_windowStart{};
+
+    bool _sampleOneIn() {
+        const bool accepted = (m_counter == 0);
+        m_counter = (m_counter + 1 == m_limit) ? 0 : m_counter + 1;
+        return accepted;
+    }
+
+    std::optional<quint64> _emitIf(bool accepted) {
+        if (!accepted) {
+            m_suppressed++;
+            return std::nullopt;
+        }
+        return std::exchange(m_suppressed, 0);
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+#endif // MESSAGESAMPLER_H
@@ -0,0 +1,128 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef MESSAGESTREAM_H
+#define MESSAGESTREAM_H
+
+#include <QDataStream>
+
+#include <expected>
+
+#include "draupnir/logging/messages/Message.h"
+
+class QIODevice;
+
+namespace Draupnir::Logging
+{
+
+/*! @enum MessageStreamFormat draupnir/logging/core/MessageStream.h
+ *  @ingroup Logging
+ *  @brief Formats supported by @ref Draupnir::Logging::MessageStreamWriter and @ref Draupnir::Logging::MessageStreamReader. */
+
+enum class MessageStreamFormat : quint8 {
+    /*! @brief One compact JSON object per line. Human-readable and easy to process with external tools. */
+    JsonLines,
+    /*! @brief Compact binary format based on `QDataStream`, prefixed with a versioned header. */
+    Binary
+};
+
+/*! @class MessageStreamWriter draupnir/logging/core/MessageStream.h
+ *  @ingroup Logging
+ *  @brief Writes @ref Draupnir::Logging::Message objects one by one into a `QIODevice`.
+ *
+ *  @details Messages are serialized record by record, so exporting does not require building the whole output in memory.
+ *           Categories are stored by their registered names (see @ref Draupnir::Logging::MessageCategory::name), field keys -
+ *           by their interned names, so stored messages can be loaded by another process.
+ *
+ *           Usage:
+ *           @code
+ *           QFile file{"messages.jsonl"};
+ *           file.open(QIODevice::WriteOnly);
+ *           MessageStreamWriter writer{&file, MessageStreamFormat::JsonLines};
+ *           for (const Message* message : messages)
+ *               writer.write(*message);
+ *           @endcode */
+
+class MessageStreamWriter final
+{
+    Q_DISABLE_COPY(MessageStreamWriter);
+public:
+    /*! @brief Constructor.
+     *  @param device Device opened for writing. Must outlive this writer.
+     *  @param format Output format. */
+    MessageStreamWriter(QIODevice* device, MessageStreamFormat format);
+
+    /*! @brief Writes a single message.
+     *  @return Nothing on success or an error description. */
+    std::expected<void,QString> write(const Message& message);
+
+private:
+    QIODevice* p_device;
+    QDataStream m_dataStream;
+    MessageStreamFormat m_format;
+    bool m_headerWritten;
+
+    std::expected<void,QString> _writeJsonLine(const Message& message);
+    std::expected<void,QString> _writeBinaryRecord(const Message& message);
+};
+
+/*! @class MessageStreamReader draupnir/logging/core/MessageStream.h
+ *  @ingroup Logging
+ *  @brief Reads @ref Draupnir::Logging::Message objects written by @ref Draupnir::Logging::MessageStreamWriter in chunks.
+ *
+ *  @details Only a single record is held in memory at a time besides the returned chunk, so files of arbitrary size can be
+ *           processed. Categories and field keys are interned on read. The reader does not depend on any GUI classes and can
+ *           be used from a worker thread (see @ref Draupnir::Logging::MessageListImporter). */
+
+class MessageStreamReader final
+{
+    Q_DISABLE_COPY(MessageStreamReader);
+public:
+    /*! @brief Constructor.
+     *  @param device Device opened for reading. Must outlive this reader.
+     *  @param format Input format. */
+    MessageStreamReader(QIODevice* device, MessageStreamFormat format);
+
+    /*! @brief Reads up to `maxCount` messages.
+     *  @return List of read messages (may be empty if the device is at its end) or an error description. Ownership of the
+     *          returned messages is transferred to the caller. If an error occurs, messages read within this call are deleted. */
+    std::expected<MessageList,QString> readChunk(int maxCount);
+
+    /*! @brief Returns `true` if there is nothing more to read. */
+    bool atEnd() const;
+
+private:
+    QIODevice* p_device;
+    QDataStream m_dataStream;
+    MessageStreamFormat m_format;
+    bool m_headerRead;
+
+    std::expected<Message*,QString> _readJsonLine();
+    std::expected<Message*,QString> _readBinaryRecord();
+};
+
+}; // namespace Draupnir::Logging
+
+#endif // MESSAGESTREAM_H
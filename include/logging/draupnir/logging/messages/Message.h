@@ -30,14 +30,21 @@
 #include <QIcon>
 #include <QList>
 
+#include "draupnir/logging/messages/MessageFields.h"
 #include "draupnir/logging/messages/MessageTypes.h"
 
 namespace Draupnir::Logging
 {
 
+class MessageGroupBuffer;
+
 /*! @class Message draupnir/logging/messages/Message.h
  *  @ingroup Logging
- *  @brief Represents an application log message describing an occurred event. */
+ *  @brief Represents an application log message describing an occurred event.
+ *
+ *  @details Besides `brief` and `what` texts a message may carry structured @ref Draupnir::Logging::MessageFields (request
+ *           identifiers, durations, byte counts, etc.). These are stored typed and are rendered into text only when the
+ *           message is displayed, so they can be filtered and aggregated without parsing strings. */
 
 class Message final
 {
@@ -64,6 +71,42 @@ public:
         return new Message{ MessageType{messageLevel, messageCategory}, brief, what };
     }
 
+    /*! @brief Creates a new message with empty brief text and structured fields.
+     *  @param text Message text.
+     *  @param fields Structured fields of the message. String values are copied, so they may refer to temporary strings.
+     *  @param messageLevel Message severity level.
+     *  @param messageCategory Message category.
+     *  @return Pointer to the newly created @ref Message object.
+     * @note The caller receives ownership of the returned pointer. */
+    static Message* create(const QString& text, MessageFields fields, MessageLevel::Value messageLevel, MessageCategory messageCategory = MessageCategory::Default) {
+        return new Message{ MessageType{messageLevel, messageCategory}, "", text, std::move(fields) };
+    }
+
+    /*! @brief Creates a new message with brief and full text and structured fields.
+     *  @param brief Short message summary.
+     *  @param what Full message text.
+     *  @param fields Structured fields of the message. String values are copied, so they may refer to temporary strings.
+     *  @param messageLevel Message severity level.
+     *  @param messageCategory Message category.
+     *  @return Pointer to the newly created @ref Message object.
+     * @note The caller receives ownership of the returned pointer. */
+    static Message* create(const QString& brief, const QString& what, MessageFields fields, MessageLevel::Value messageLevel, MessageCategory messageCategory = MessageCategory::Default) {
+        return new Message{ MessageType{messageLevel, messageCategory}, brief, what, std::move(fields) };
+    }
+
+    /*! @brief Recreates a previously stored message, e.g. when importing messages from a file.
+     *  @param type Message type.
+     *  @param brief Short message summary.
+     *  @param what Full message text.
+     *  @param dateTime Time when the original message was created.
+     *  @param fields Structured fields of the message. String values may refer into `fieldStorage`.
+     *  @param fieldStorage Buffer holding string values of `fields`. It is owned by the created message.
+     *  @return Pointer to the newly created @ref Message object.
+     * @note The caller receives ownership of the returned pointer. */
+    static Message* restore(MessageType type, QString brief, QString what, const QDateTime& dateTime, MessageFields fields, QByteArray fieldStorage = {}) {
+        return new Message{ type, std::move(brief), std::move(what), dateTime, std::move(fields), std::move(fieldStorage) };
+    }
+
     /*! @brief Returns type of this @ref Message object. */
     MessageType type() const { return m_type; };
 
@@ -76,33 +119,68 @@ public:
     /*! @brief Returns `QDateTime` when this @ref Message object was created. */
     QDateTime dateTime() const { return m_dateTime; }
 
+    /*! @brief Returns structured fields of this @ref Message object. */
+    const MessageFields& fields() const { return m_fields; }
+
 private:
+    friend class MessageGroupBuffer;
+
     /*! @brief Constructor. Creates a message object.
      *  @param newType Message type.
      *  @param brief Short message summary.
-     *  @param what Full message text. */
-    Message(const MessageType newType, const QString& brief, const QString& what) :
+     *  @param what Full message text.
+     *  @param fields Structured fields. Their string values are copied into `m_fieldStorage`. */
+    Message(const MessageType newType, const QString& brief, const QString& what, MessageFields fields = {}) :
         m_type{newType},
         m_brief{brief},
         m_what{what},
-        m_dateTime{QDateTime::currentDateTime()}
+        m_dateTime{QDateTime::currentDateTime()},
+        m_fieldStorage{fields.copyStrings()},
+        m_fields{std::move(fields)}
     {}
 
     /*! @brief Constructor. Creates a message object using movable strings.
      *  @param newType Message type.
      *  @param brief Short message summary.
-     *  @param what Full message text. */
-    Message(const MessageType newType, QString&& brief, QString&& what) :
+     *  @param what Full message text.
+     *  @param fields Structured fields. Their string values are copied into `m_fieldStorage`. */
+    Message(const MessageType newType, QString&& brief, QString&& what, MessageFields fields = {}) :
         m_type{newType},
         m_brief{std::move(brief)},
         m_what{std::move(what)},
-        m_dateTime{QDateTime::currentDateTime()}
+        m_dateTime{QDateTime::currentDateTime()},
+        m_fieldStorage{fields.copyStrings()},
+        m_fields{std::move(fields)}
+    {}
+
+    /*! @brief Constructor used by @ref restore.
+     *  @param newType Message type.
+     *  @param brief Short message summary.
+     *  @param what Full message text.
+     *  @param dateTime Creation time of the original message.
+     *  @param fields Structured fields.
+     *  @param fieldStorage Buffer holding string values of `fields`. */
+    Message(const MessageType newType, QString&& brief, QString&& what, const QDateTime& dateTime, MessageFields fields, QByteArray&& fieldStorage) :
+        m_type{newType},
+        m_brief{std::move(brief)},
+        m_what{std::move(what)},
+        m_dateTime{dateTime},
+        m_fieldStorage{std::move(fieldStorage)},
+        m_fields{std::move(fields)}
     {}
 
     const MessageType m_type;
     const QString m_brief;
     const QString m_what;
     const QDateTime m_dateTime;
+
+    /*! @brief Owns string values of `m_fields`. Empty if there are none. */
+    const QByteArray m_fieldStorage;
+
+    const MessageFields m_fields;
+
+    /*! @brief Intrusive link used by @ref Draupnir::Logging::MessageGroupBuffer while this message is buffered in a group. */
+    Message* p_nextInGroup = nullptr;
 };
 
 /*! @brief Convenience alias for a list of owned or non-owned message pointers.
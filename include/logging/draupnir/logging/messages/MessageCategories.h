@@ -25,10 +25,15 @@
 #ifndef MESSAGECATEGORIES_H
 #define MESSAGECATEGORIES_H
 
+#include <QLatin1String>
 #include <QMetaType>
+#include <QVector>
+
+#include <initializer_list>
+#include <optional>
+#include <string_view>
 
 #include "draupnir/utils/integer_wrapper.h"
-#include "draupnir/utils/flags.h"
 
 namespace Draupnir::Logging
 {
@@ -38,50 +43,230 @@ namespace Draupnir::Logging
  *  @brief Represents a log message category identifier.
  *
  *  @details Message categories are used in combination with @ref Draupnir::Logging::MessageLevel to form a complete @ref
- *           Draupnir::Logging::MessageType. Categories are represented as bit-like integer identifiers, allowing them
- *           to be combined into category masks where needed. */
+ *           Draupnir::Logging::MessageType. Categories are dense small integers, so the amount of categories is not limited
+ *           by the width of a bit mask. Sets of categories are represented by @ref Draupnir::Logging::MessageCategories.
+ *
+ *           Categories can be declared at compile time using @ref nextType and bound to their names with @ref registerName,
+ *           or created at runtime from their names with @ref intern. The two kinds use disjoint ranges of values, separated by
+ *           @ref FirstInternedCategory. Lookup in both directions is O(1).
+ *
+ *           Usage:
+ *           @code
+ *           // Compile-time category, named at startup
+ *           static constexpr MessageCategory NetworkCategory = MessageCategory::nextType(MessageCategory::FirstCustomCategory);
+ *           MessageCategory::registerName(NetworkCategory, "network");
+ *
+ *           // Runtime category
+ *           const MessageCategory storageCategory = MessageCategory::intern("storage");
+ *           @endcode
+ *
+ *           Migration from one-hot categories: categories used to be single bits combined with `|` into a mask. Now they are
+ *           dense indices, so:
+ *           - one-hot constants (e.g. `MessageCategory{0b1000'0000}`) must be replaced with values declared by @ref nextType
+ *             (or created by @ref intern), otherwise they may land within the range of interned categories;
+ *           - `category | otherCategory` of two MessageCategory values does not compile anymore, build the set explicitly:
+ *             `MessageCategories{category, otherCategory}` or `MessageCategories{category} | otherCategory`;
+ *           - masks are tested with @ref Draupnir::Logging::MessageCategories::test_flag instead of `&`.
+ *
+ * @note Value `0` is not a valid category. Remaining bitwise operators inherited from @ref draupnir::utils::integer_wrapper
+ *       operate on the raw value and do not combine categories - use @ref Draupnir::Logging::MessageCategories for that. */
 
-class MessageCategory : public draupnir::utils::integer_wrapper<quint64, MessageCategory>
+class MessageCategory : public draupnir::utils::integer_wrapper<quint32, MessageCategory>
 {
-    using _Base = draupnir::utils::integer_wrapper<quint64, MessageCategory>;
+    using _Base = draupnir::utils::integer_wrapper<quint32, MessageCategory>;
 
 public:
     /*! @enum MessageCategory::Value
      *  @brief Built-in message category values. */
     enum Value {
         /*! @brief Default message category used when no custom category is specified. */
-        Default = 0b1,
+        Default = 1,
         /*! @brief First value reserved for user-defined message categories. */
-        FirstCustomCategory = 0b10,        
+        FirstCustomCategory = 2,
+        /*! @brief First value of categories created by @ref intern. Categories declared with @ref nextType must stay
+         *         below it, so both kinds never share a value. */
+        FirstInternedCategory = 1024,
     };
 
-    using draupnir::utils::integer_wrapper<quint64, MessageCategory>::integer_wrapper;
+    using draupnir::utils::integer_wrapper<quint32, MessageCategory>::integer_wrapper;
 
-    using draupnir::utils::integer_wrapper<quint64, MessageCategory>::operator=;
+    using draupnir::utils::integer_wrapper<quint32, MessageCategory>::operator=;
+
+///@name Combining categories with `|` is deleted, as categories are not bits. Use @ref Draupnir::Logging::MessageCategories.
+///@{
+    friend MessageCategory operator|(MessageCategory lhs, MessageCategory rhs) = delete;
+    MessageCategory& operator|=(MessageCategory other) = delete;
+///@}
 
     /*! @brief Returns the next available message category ID.
      *  @param prevType The previous MessageCategory.
-     *  @return A new MessageCategory with the value shifted left by 1. */
-    static constexpr MessageCategory nextType(MessageCategory::integer_wrapper prevType) {
-        return MessageCategory{prevType << 1};
+     *  @return A new MessageCategory with the value incremented by 1. */
+    static constexpr MessageCategory nextType(MessageCategory prevType) {
+        Q_ASSERT_X(prevType.value() + 1 < FirstInternedCategory, "MessageCategory::nextType",
+                   "Compile-time categories must stay below MessageCategory::FirstInternedCategory.");
+        return MessageCategory{prevType.value() + 1};
     }
+
+///@name Name registry. All of these methods are thread-safe.
+///@{
+    /*! @brief Returns category registered for `name`, creating a new category if the name is not yet known. New categories
+     *         are allocated sequentially from @ref FirstInternedCategory, so they never collide with categories declared
+     *         by @ref nextType, even with those never bound to a name.
+     *  @param name Category name. Must not be empty. */
+    static MessageCategory intern(std::string_view name);
+
+    /*! @brief Binds `name` to the compile-time declared `category`.
+     *  @return `true` on success; `false` if either the name or the category is already bound to something else, or if
+     *          `category` is within the range of interned categories. */
+    static bool registerName(MessageCategory category, std::string_view name);
+
+    /*! @brief Returns category registered for `name` or `std::nullopt` if the name is not known. */
+    static std::optional<MessageCategory> find(std::string_view name);
+
+    /*! @brief Returns name of this category or empty string if no name was registered for it. */
+    QLatin1String name() const;
+///@}
 };
 
-class MessageCategories final : public draupnir::utils::flags<MessageCategory>
-{
-    using _Base = draupnir::utils::flags<MessageCategory>;
+/*! @class MessageCategories draupnir/logging/messages/MessageCategories.h
+ *  @ingroup Logging
+ *  @brief Set of @ref Draupnir::Logging::MessageCategory values.
+ *
+ *  @details Dynamic bitset indexed by category value. First 64 categories are kept inline, so testing them costs the same as
+ *           testing a plain 64-bit mask. Bits for other categories are allocated on demand. Categories which were never set
+ *           or cleared explicitly take the value of the whole set default, so @ref All also covers categories created after
+ *           the set was built. */
 
+class MessageCategories final
+{
 public:
-    using _Base::flags;
+    /*! @brief Constructs empty set. */
+    MessageCategories() = default;
+
+    /*! @brief Constructs set containing a single `category`. */
+    MessageCategories(MessageCategory category) { set_flag(category, true); }
+
+    /*! @brief Constructs set containing a single built-in `category`. */
+    MessageCategories(MessageCategory::Value category) : MessageCategories{MessageCategory{category}} {}
+
+    /*! @brief Constructs set containing provided `categories`. */
+    MessageCategories(std::initializer_list<MessageCategory> categories) {
+        for (MessageCategory category : categories)
+            set_flag(category, true);
+    }
+
+    /*! @brief Set containing no categories. */
+    static const MessageCategories None;
+
+    /*! @brief Set containing every category, including categories created later. */
+    static const MessageCategories All;
+
+    /*! @brief Returns `true` if `category` belongs to this set. */
+    bool test_flag(MessageCategory category) const noexcept {
+        const quint32 index = category.value();
+        if (Q_LIKELY(index < _wordBits))
+            return (m_firstWord >> index) & 1u;
+        return _testOtherWords(index);
+    }
 
-    using _Base::operator=;
+    /*! @brief Adds `category` to (`isSet == true`) or removes it from (`isSet == false`) this set. */
+    void set_flag(MessageCategory category, bool isSet) {
+        const quint32 index = category.value();
+        quint64& word = (index < _wordBits) ? m_firstWord : _otherWord(index);
+        const quint64 bit = quint64{1} << (index % _wordBits);
+        word = isSet ? (word | bit) : (word & ~bit);
+    }
+
+    /*! @brief Returns `true` if at least one category belongs to this set. */
+    bool any() const noexcept { return !none(); }
+
+    /*! @brief Returns `true` if no category belongs to this set. */
+    bool none() const noexcept {
+        if (m_firstWord != 0 || m_othersDefault)
+            return false;
+        for (quint64 word : m_otherWords) {
+            if (word != 0)
+                return false;
+        }
+        return true;
+    }
+
+    /*! @brief Adds all categories from `other` to this set. */
+    MessageCategories& operator|=(const MessageCategories& other) {
+        m_firstWord |= other.m_firstWord;
+        const int size = qMax(m_otherWords.size(), other.m_otherWords.size());
+        _growOtherWords(size);
+        for (int i = 0; i < size; i++)
+            m_otherWords[i] |= other._otherWordValue(i);
+        m_othersDefault = m_othersDefault || other.m_othersDefault;
+        return *this;
+    }
+
+    /*! @brief Returns union of two sets. */
+    friend MessageCategories operator|(MessageCategories lhs, const MessageCategories& rhs) { return lhs |= rhs; }
+
+    /*! @brief Returns `true` if both sets contain the same categories. */
+    friend bool operator==(const MessageCategories& lhs, const MessageCategories& rhs) noexcept {
+        if (lhs.m_firstWord != rhs.m_firstWord || lhs.m_othersDefault != rhs.m_othersDefault)
+            return false;
+        const int size = qMax(lhs.m_otherWords.size(), rhs.m_otherWords.size());
+        for (int i = 0; i < size; i++) {
+            if (lhs._otherWordValue(i) != rhs._otherWordValue(i))
+                return false;
+        }
+        return true;
+    }
+
+    friend bool operator!=(const MessageCategories& lhs, const MessageCategories& rhs) noexcept { return !(lhs == rhs); }
+
+private:
+    static constexpr quint32 _wordBits = 64;
+
+    /*! @brief Bits of categories `0..63`. */
+    quint64 m_firstWord = 0;
 
-    static constexpr _Base::integer None = 0;
+    /*! @brief Bits of categories starting from `64`. Word `i` holds categories `64 * (i + 1) .. 64 * (i + 2) - 1`. */
+    QVector<quint64> m_otherWords;
 
-    static constexpr _Base::integer All =
-        std::numeric_limits<MessageCategory::underlying_type>::max();
+    /*! @brief Value of the categories not covered by `m_otherWords`. */
+    bool m_othersDefault = false;
+
+    /*! @brief Returns word `i` of `m_otherWords`, or the default word if it is not allocated. */
+    quint64 _otherWordValue(int i) const noexcept {
+        if (i < m_otherWords.size())
+            return m_otherWords[i];
+        return _defaultWord();
+    }
+
+    /*! @brief Returns word matching `m_othersDefault`. */
+    quint64 _defaultWord() const noexcept { return m_othersDefault ? ~quint64{0} : quint64{0}; }
+
+    void _growOtherWords(int size) {
+        if (m_otherWords.size() < size)
+            m_otherWords.insert(m_otherWords.end(), size - m_otherWords.size(), _defaultWord());
+    }
+
+    bool _testOtherWords(quint32 index) const noexcept {
+        return (_otherWordValue(static_cast<int>(index / _wordBits) - 1) >> (index % _wordBits)) & 1u;
+    }
+
+    quint64& _otherWord(quint32 index) {
+        const int wordIndex = static_cast<int>(index / _wordBits) - 1;
+        _growOtherWords(wordIndex + 1);
+        return m_otherWords[wordIndex];
+    }
+
+    /*! @brief Constructs set in which every category is (`isSet == true`) or is not (`isSet == false`) present. */
+    struct _FillTag {};
+    MessageCategories(_FillTag, bool isSet) :
+        m_firstWord{isSet ? ~quint64{0} : quint64{0}},
+        m_othersDefault{isSet}
+    {}
 };
 
+inline const MessageCategories MessageCategories::None{MessageCategories::_FillTag{}, false};
+inline const MessageCategories MessageCategories::All{MessageCategories::_FillTag{}, true};
+
 } // Draupnir::Logging
 
 Q_DECLARE_METATYPE(Draupnir::Logging::MessageCategory);
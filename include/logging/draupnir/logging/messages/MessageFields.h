@@ -0,0 +1,397 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef MESSAGEFIELDS_H
+#define MESSAGEFIELDS_H
+
+#include <QByteArray>
+#include <QString>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "draupnir/utils/integer_wrapper.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageFieldKey draupnir/logging/messages/MessageFields.h
+ *  @ingroup Logging
+ *  @brief Interned name of a structured @ref Draupnir::Logging::Message field.
+ *
+ *  @details Field names are interned once into a process-wide registry and are represented by a dense integer afterwards,
+ *           so messages store and compare keys without keeping strings around. Value `0` is reserved for the invalid key.
+ *
+ *           Usage:
+ *           @code
+ *           static const MessageFieldKey requestIdKey = MessageFieldKey::intern("request_id");
+ *           @endcode */
+
+class MessageFieldKey : public draupnir::utils::integer_wrapper<quint32, MessageFieldKey>
+{
+public:
+    using draupnir::utils::integer_wrapper<quint32, MessageFieldKey>::integer_wrapper;
+    using draupnir::utils::integer_wrapper<quint32, MessageFieldKey>::operator=;
+
+    /*! @brief Returns key for the provided name, registering the name if it was not yet known. This method is thread-safe.
+     *  @param name Field name.
+     *  @return Interned key. Repeated calls with the same name return the same key. */
+    static MessageFieldKey intern(std::string_view name);
+
+    /*! @brief Returns key for the provided name if it was already interned. This method is thread-safe.
+     *  @param name Field name.
+     *  @return Interned key or `std::nullopt` if the name is not known. */
+    static std::optional<MessageFieldKey> find(std::string_view name);
+
+    /*! @brief Returns name of this key or empty string for the invalid key. This method is thread-safe. */
+    QLatin1String name() const;
+};
+
+/*! @class MessageFieldValue draupnir/logging/messages/MessageFields.h
+ *  @ingroup Logging
+ *  @brief Typed value of a structured @ref Draupnir::Logging::Message field.
+ *
+ *  @details Holds one of `qint64`, `double`, `bool` or a string view within 16 bytes, without any heap allocation.
+ *
+ * @note String values are not copied, the value only refers to the provided characters. Messages are delivered to the
+ *       handler asynchronously and may be kept by models for the rest of the application run, so the characters must stay
+ *       valid and unchanged for the lifetime of the process: string literals, `static` storage or names returned by
+ *       @ref Draupnir::Logging::MessageFieldKey::name. Messages created by @ref Draupnir::Logging::Message::create copy
+ *       string values of their fields into storage they own (see @ref Draupnir::Logging::MessageFields::copyStrings), so
+ *       strings built at runtime may be passed there. */
+
+class MessageFieldValue
+{
+public:
+    /*! @enum MessageFieldValue::Type
+     *  @brief Type of the stored value. */
+    enum Type : uint8_t {
+        Int64,  /*!< @brief Signed 64-bit integer. */
+        Double, /*!< @brief Floating point value. */
+        String, /*!< @brief Non-owning string view. */
+        Bool    /*!< @brief Boolean value. */
+    };
+
+    /*! @brief Constructs integer value `0`. */
+    constexpr MessageFieldValue() noexcept :
+        m_int64{0}, m_stringSize{0}, m_type{Int64}
+    {}
+
+    /*! @brief Constructs integer value. */
+    template<std::integral Integer> requires(!std::same_as<Integer,bool>)
+    constexpr MessageFieldValue(Integer value) noexcept :
+        m_int64{static_cast<qint64>(value)}, m_stringSize{0}, m_type{Int64}
+    {}
+
+    /*! @brief Constructs floating point value. */
+    template<std::floating_point Floating>
+    constexpr MessageFieldValue(Floating value) noexcept :
+        m_double{static_cast<double>(value)}, m_stringSize{0}, m_type{Double}
+    {}
+
+    /*! @brief Constructs boolean value. */
+    template<std::same_as<bool> Boolean>
+    constexpr MessageFieldValue(Boolean value) noexcept :
+        m_bool{value}, m_stringSize{0}, m_type{Bool}
+    {}
+
+    /*! @brief Constructs string value referring to `value`. */
+    constexpr MessageFieldValue(std::string_view value) noexcept :
+        m_string{value.data()}, m_stringSize{static_cast<quint32>(value.size())}, m_type{String}
+    {}
+
+    /*! @brief Constructs string value referring to the null-terminated `value`. */
+    constexpr MessageFieldValue(const char* value) noexcept :
+        MessageFieldValue{std::string_view{value}}
+    {}
+
+    /*! @brief Returns type of the stored value. */
+    constexpr Type type() const noexcept { return m_type; }
+
+    /*! @brief Returns `true` if stored value is either @ref Int64 or @ref Double. */
+    constexpr bool isNumeric() const noexcept { return m_type == Int64 || m_type == Double; }
+
+    /*! @brief Returns stored integer. Double values are truncated, other types return `0`. */
+    constexpr qint64 toInt64() const noexcept {
+        switch (m_type) {
+        case Int64:  return m_int64;
+        case Double: return static_cast<qint64>(m_double);
+        case Bool:   return m_bool ? 1 : 0;
+        case String: return 0;
+        }
+        return 0;
+    }
+
+    /*! @brief Returns stored number as `double`. Non-numeric types return `0.0`. */
+    constexpr double toDouble() const noexcept {
+        switch (m_type) {
+        case Int64:  return static_cast<double>(m_int64);
+        case Double: return m_double;
+        case Bool:   return m_bool ? 1.0 : 0.0;
+        case String: return 0.0;
+        }
+        return 0.0;
+    }
+
+    /*! @brief Returns stored boolean. Numeric types return `true` when not equal to zero, strings - when not empty. */
+    constexpr bool toBool() const noexcept {
+        switch (m_type) {
+        case Int64:  return m_int64 != 0;
+        case Double: return m_double != 0.0;
+        case Bool:   return m_bool;
+        case String: return m_stringSize != 0;
+        }
+        return false;
+    }
+
+    /*! @brief Returns stored string view. Non-string types return empty view. */
+    constexpr std::string_view toStringView() const noexcept {
+        return (m_type == String) ? std::string_view{m_string, m_stringSize} : std::string_view{};
+    }
+
+    /*! @brief Renders stored value into a user-readable string. */
+    QString toString() const {
+        switch (m_type) {
+        case Int64:  return QString::number(m_int64);
+        case Double: return QString::number(m_double);
+        case Bool:   return m_bool ? QStringLiteral("true") : QStringLiteral("false");
+        case String: return QString::fromUtf8(m_string, static_cast<int>(m_stringSize));
+        }
+        Q_UNREACHABLE();
+        return QString{};
+    }
+
+    /*! @brief Compares two values. Values of different types are never equal; strings are compared by content. */
+    constexpr bool operator==(const MessageFieldValue& other) const noexcept {
+        if (m_type != other.m_type)
+            return false;
+        switch (m_type) {
+        case Int64:  return m_int64 == other.m_int64;
+        case Double: return m_double == other.m_double;
+        case Bool:   return m_bool == other.m_bool;
+        case String: return toStringView() == other.toStringView();
+        }
+        return false;
+    }
+
+private:
+    union {
+        qint64 m_int64;
+        double m_double;
+        bool m_bool;
+        const char* m_string;
+    };
+    quint32 m_stringSize;
+    Type m_type;
+};
+
+/*! @class MessageField draupnir/logging/messages/MessageFields.h
+ *  @ingroup Logging
+ *  @brief Single structured field of a @ref Draupnir::Logging::Message - pair of interned key and typed value.
+ *
+ * @note Field does not own string values, see @ref Draupnir::Logging::MessageFieldValue for the lifetime requirements. */
+
+struct MessageField
+{
+    MessageFieldKey key;
+    MessageFieldValue value;
+};
+
+/*! @class MessageFields draupnir/logging/messages/MessageFields.h
+ *  @ingroup Logging
+ *  @brief Compact list of @ref Draupnir::Logging::MessageField objects attached to a @ref Draupnir::Logging::Message.
+ *
+ *  @details Messages carry few fields, so the first @ref InlineCapacity fields are stored within the list itself and
+ *           neither an empty list nor a typical one allocates. Appending beyond that moves the fields into a heap block,
+ *           which grows by doubling; the inline space then holds the pointer to it. Fields are kept in the order they
+ *           were added.
+ *
+ *           Usage:
+ *           @code
+ *           logger.logMessage(Message::create("Request served", MessageFields{
+ *               {requestIdKey, 42},
+ *               {durationKey, 12.5},
+ *               {cachedKey, true}
+ *           }, MessageLevel::Info));
+ *           @endcode */
+
+class MessageFields
+{
+public:
+    /*! @brief Amount of fields stored without allocating. */
+    static constexpr int InlineCapacity = 3;
+
+    /*! @brief Constructs empty field list. Does not allocate. */
+    MessageFields() = default;
+
+    /*! @brief Constructs field list from `fields`. */
+    MessageFields(std::initializer_list<MessageField> fields) {
+        _reserve(static_cast<int>(fields.size()));
+        for (const MessageField& field : fields)
+            append(field.key, field.value);
+    }
+
+    /*! @brief Copy constructor. Allocates exactly the amount of fields of `other` if they do not fit inline. */
+    MessageFields(const MessageFields& other) {
+        _reserve(other.m_count);
+        std::copy(other.begin(), other.end(), begin());
+        m_count = other.m_count;
+    }
+
+    /*! @brief Move constructor. Takes over the heap block of `other`, if any, and leaves `other` empty. */
+    MessageFields(MessageFields&& other) noexcept {
+        _take(other);
+    }
+
+    /*! @brief Destructor. Releases the heap block, if any. */
+    ~MessageFields() {
+        if (!_isInline())
+            delete[] p_heapFields;
+    }
+
+    MessageFields& operator=(const MessageFields& other) {
+        if (this != &other)
+            *this = MessageFields{other};
+        return *this;
+    }
+
+    MessageFields& operator=(MessageFields&& other) noexcept {
+        if (this != &other) {
+            if (!_isInline())
+                delete[] p_heapFields;
+            _take(other);
+        }
+        return *this;
+    }
+
+    /*! @brief Appends a field. If a field with the same key is already present, its value is replaced.
+     *  @param key Interned field key. Must be valid.
+     *  @param value Field value. */
+    void append(MessageFieldKey key, MessageFieldValue value) {
+        Q_ASSERT_X(key, "MessageFields::append", "Provided MessageFieldKey is invalid.");
+        for (MessageField& field : *this) {
+            if (field.key == key) {
+                field.value = value;
+                return;
+            }
+        }
+
+        if (m_count == m_capacity)
+            _reserve(m_capacity * 2);
+        begin()[m_count] = MessageField{key, value};
+        m_count++;
+    }
+
+    /*! @brief Returns value of the field with provided key or `nullptr` if no such field is present. */
+    const MessageFieldValue* value(MessageFieldKey key) const {
+        for (const MessageField& field : *this) {
+            if (field.key == key)
+                return &field.value;
+        }
+        return nullptr;
+    }
+
+    /*! @brief Returns `true` if field with provided key is present. */
+    bool contains(MessageFieldKey key) const { return value(key) != nullptr; }
+
+    /*! @brief Returns amount of fields. */
+    int count() const { return m_count; }
+
+    /*! @brief Returns `true` if there are no fields. */
+    bool isEmpty() const { return m_count == 0; }
+
+    /*! @brief Returns amount of fields which can be stored without allocating. */
+    int capacity() const { return m_capacity; }
+
+    /*! @brief Returns `true` if fields are stored within the list itself rather than in a heap block. */
+    bool isInline() const { return _isInline(); }
+
+    /*! @brief Copies string values into the returned buffer and makes them refer into it. The buffer must outlive these
+     *         fields and all their copies. Returns empty buffer if there are no string values. */
+    QByteArray copyStrings();
+
+    MessageField* begin() { return _isInline() ? std::launder(reinterpret_cast<MessageField*>(m_inlineFields)) : p_heapFields; }
+    MessageField* end() { return begin() + m_count; }
+    const MessageField* begin() const { return const_cast<MessageFields*>(this)->begin(); }
+    const MessageField* end() const { return begin() + m_count; }
+
+    /*! @brief Renders fields into `key=value` pairs separated by `", "`. */
+    QString toString() const {
+        QString result;
+        for (const MessageField& field : *this) {
+            if (!result.isEmpty())
+                result += QLatin1String{", "};
+            result += field.key.name();
+            result += QLatin1Char{'='};
+            result += field.value.toString();
+        }
+        return result;
+    }
+
+private:
+    union {
+        /*! @brief Fields while there are at most @ref InlineCapacity of them. */
+        alignas(MessageField) std::byte m_inlineFields[InlineCapacity * sizeof(MessageField)];
+        /*! @brief Heap block holding `m_capacity` fields once they no longer fit inline. */
+        MessageField* p_heapFields;
+    };
+    int m_count = 0;
+    int m_capacity = InlineCapacity;
+
+    bool _isInline() const { return m_capacity == InlineCapacity; }
+
+    /*! @brief Makes room for at least `capacity` fields, moving the present ones into a new heap block if needed. */
+    void _reserve(int capacity) {
+        if (capacity <= m_capacity)
+            return;
+
+        MessageField* fields = new MessageField[capacity];
+        std::copy(begin(), end(), fields);
+        if (!_isInline())
+            delete[] p_heapFields;
+        p_heapFields = fields;
+        m_capacity = capacity;
+    }
+
+    /*! @brief Moves contents of `other` into this list, which holds no heap block, and leaves `other` empty. */
+    void _take(MessageFields& other) noexcept {
+        if (other._isInline()) {
+            std::copy(other.begin(), other.end(), std::launder(reinterpret_cast<MessageField*>(m_inlineFields)));
+        } else {
+            p_heapFields = other.p_heapFields;
+        }
+        m_count = std::exchange(other.m_count, 0);
+        m_capacity = std::exchange(other.m_capacity, InlineCapacity);
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+#endif // MESSAGEFIELDS_H
@@ -65,7 +65,11 @@ public:
      *         created. */
     QDateTime dateTime() const { return p_message->dateTime(); }
 
-    /*! @brief Returns `QString` with specified fields of the @ref Message object. */
+    /*! @brief Returns structured fields of @ref Draupnir::Logging::Message object, refered by this @ref MessageViewItem. */
+    const MessageFields& fields() const { return p_message->fields(); }
+
+    /*! @brief Returns `QString` with specified fields of the @ref Message object. Structured @ref MessageFields are rendered
+     *         together with @ref MessageViewItemField::What. */
     QString getViewString(const MessageViewItemFields& fields) const;
 
     /*! @brief This method returns an `QIcon` for the type of this @ref Message. */
@@ -0,0 +1,138 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef MESSAGELISTIMPORTER_H
+#define MESSAGELISTIMPORTER_H
+
+#include <QObject>
+
+#include <QMutex>
+#include <QPair>
+#include <QQueue>
+#include <QSemaphore>
+
+#include <atomic>
+
+#include "draupnir/logging/core/MessageStream.h"
+
+class QThread;
+
+namespace Draupnir::Logging
+{
+
+class MessageListModel;
+
+/*! @class MessageListImporter draupnir/logging/models/MessageListImporter.h
+ *  @ingroup Logging
+ *  @brief Loads messages stored by @ref Draupnir::Logging::MessageStreamWriter into a @ref Draupnir::Logging::MessageListModel
+ *         without blocking the GUI thread.
+ *
+ *  @details File is read by @ref Draupnir::Logging::MessageStreamReader on a worker thread in chunks of @ref chunkSize
+ *           messages. Each chunk is appended to the model on the thread of this object with a single
+ *           MessageListModel::append(const QList<Message*>&) call. At most @ref maxQueuedChunks chunks may wait for being
+ *           appended, so memory usage does not depend on the file size even if the GUI thread is busy.
+ *
+ *           Usage:
+ *           @code
+ *           auto importer = new MessageListImporter{model, this};
+ *           connect(importer, &MessageListImporter::progressChanged, progressBar, [progressBar](qint64 done, qint64 total) {
+ *               progressBar->setValue(total > 0 ? static_cast<int>(done * 100 / total) : 0);
+ *           });
+ *           importer->start("messages.jsonl", MessageStreamFormat::JsonLines);
+ *           @endcode */
+
+class MessageListImporter final : public QObject
+{
+    Q_OBJECT
+public:
+    /*! @brief Maximal amount of read chunks waiting to be appended to the model. */
+    static constexpr int maxQueuedChunks = 4;
+
+    /*! @brief Constructor.
+     *  @param model Model to append messages to. Must outlive this importer. */
+    explicit MessageListImporter(MessageListModel* model, QObject* parent = nullptr);
+
+    /*! @brief Destructor. Cancels running import and waits for the worker thread to finish. */
+    ~MessageListImporter() final;
+
+    /*! @brief Sets amount of messages read and appended at once. Takes effect on the next @ref start call. */
+    void setChunkSize(int chunkSize);
+
+    /*! @brief Returns amount of messages read and appended at once. */
+    int chunkSize() const { return m_chunkSize; }
+
+    /*! @brief Starts importing messages from the file.
+     *  @param fileName Path to the file.
+     *  @param format Format of the file.
+     *  @return `false` if an import is already running; `true` otherwise. Errors of opening or reading the file are reported
+     *          by the @ref finished signal. */
+    bool start(const QString& fileName, MessageStreamFormat format);
+
+    /*! @brief Requests cancellation of the running import. Chunks which were not yet appended are discarded. The @ref finished
+     *         signal is emitted once the worker thread has stopped. */
+    void cancel();
+
+    /*! @brief Returns `true` while import is running. */
+    bool isRunning() const { return p_workerThread != nullptr; }
+
+signals:
+    /*! @brief Emitted after each chunk has been appended to the model.
+     *  @param bytesProcessed Amount of bytes of the file processed so far.
+     *  @param bytesTotal File size. */
+    void progressChanged(qint64 bytesProcessed, qint64 bytesTotal);
+
+    /*! @brief Emitted when import is finished, failed or cancelled.
+     *  @param success `true` if the whole file was imported.
+     *  @param errorString Error description if `success` is `false`. */
+    void finished(bool success, const QString& errorString);
+
+private:
+    MessageListModel* p_model;
+    int m_chunkSize;
+    QThread* p_workerThread;
+
+    /*! @brief Chunks read by the worker thread, together with the amount of bytes processed when each chunk was read. */
+    QQueue<QPair<MessageList,qint64>> m_readyChunks;
+    QMutex m_readyChunksMutex;
+    QSemaphore m_freeChunkSlots;
+    std::atomic<bool> m_cancelRequested;
+    qint64 m_bytesTotal;
+
+    /*! @brief Body of the worker thread. */
+    void _readFile(const QString& fileName, MessageStreamFormat format, int chunkSize);
+
+    /*! @brief Appends chunks read by the worker thread to the model. Executed on the thread of this object. */
+    void _appendReadyChunks();
+
+    /*! @brief Finalizes import once the worker thread has finished. Executed on the thread of this object. */
+    void _onWorkerFinished(bool success, const QString& errorString);
+
+    /*! @brief Deletes messages of chunks which were not yet appended. */
+    void _discardReadyChunks();
+};
+
+}; // namespace Draupnir::Logging
+
+#endif // MESSAGELISTIMPORTER_H
@@ -29,10 +29,13 @@
 
 #include <QList>
 
+#include <expected>
+
 namespace Draupnir::Logging
 {
 
 class Message;
+class MessageStreamWriter;
 class MessageViewItem;
 
 /*! @class MessageListModel draupnir/logging/models/MessageListModel.h
@@ -75,6 +78,10 @@ public:
     /*! @brief Adds a list of the @ref Draupnir::Logging::MessageViewItem objects to the model. */
     void append(const QList<MessageViewItem*>& messages);
 
+    /*! @brief Writes all messages of this model, one by one, using provided `writer`.
+     *  @return Nothing on success or an error description. */
+    std::expected<void,QString> exportMessages(MessageStreamWriter& writer) const;
+
     /*! @brief This method clears content of this model.
      * @note All @ref Draupnir::Messages::Message objects are deleted upon calling this method. */
     void clear();
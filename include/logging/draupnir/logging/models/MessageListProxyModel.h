@@ -27,6 +27,9 @@
 
 #include <QSortFilterProxyModel>
 
+#include <functional>
+
+#include "draupnir/logging/messages/MessageFields.h"
 #include "draupnir/logging/messages/MessageTypes.h"
 #include "draupnir/logging/messages/MessageViewItemFields.h"
 
@@ -43,6 +46,20 @@ class MessageListProxyModel final : public QSortFilterProxyModel
 {
     Q_OBJECT
 public:
+    /*! @brief Predicate applied to the value of a structured field by @ref setMessageFieldFilter. */
+    using MessageFieldPredicate = std::function<bool(const MessageFieldValue&)>;
+
+    /*! @brief Result of @ref aggregateMessageField. */
+    struct MessageFieldAggregate {
+        int count = 0;      /*!< @brief Amount of displayed messages having numeric value of the field. */
+        double sum = 0.0;   /*!< @brief Sum of the values. */
+        double min = 0.0;   /*!< @brief Minimal value, `0.0` if `count == 0`. */
+        double max = 0.0;   /*!< @brief Maximal value, `0.0` if `count == 0`. */
+
+        /*! @brief Returns average value or `0.0` if `count == 0`. */
+        double average() const { return (count == 0) ? 0.0 : sum / count; }
+    };
+
     static inline constexpr MessageViewItemFields DefaultDisplayedMessageItemFields =
         MessageViewItemFields::All;
 
@@ -85,6 +102,23 @@ public:
     bool isMessageCategoryDisplayed(MessageCategory messageCategory) { return m_displayedMessageCategoriesMask.test_flag(messageCategory); }
 ///@}
 
+///@name Methods to filter and aggregate messages by their structured @ref Draupnir::Logging::MessageFields.
+///@{
+    /*! @brief Displays only messages having field `key` for which `predicate` returns `true`. Replaces previously set field
+     *         filter. Values are inspected typed, without any string parsing. */
+    void setMessageFieldFilter(MessageFieldKey key, MessageFieldPredicate predicate);
+
+    /*! @brief Removes filter set by @ref setMessageFieldFilter. */
+    void clearMessageFieldFilter();
+
+    /*! @brief Returns `true` if filter by structured field is set. */
+    bool hasMessageFieldFilter() const { return static_cast<bool>(m_messageFieldPredicate); }
+
+    /*! @brief Aggregates numeric values of field `key` over the messages currently displayed by this model. Messages without
+     *         the field or with non-numeric value are skipped. */
+    MessageFieldAggregate aggregateMessageField(MessageFieldKey key) const;
+///@}
+
 ///@name This is a group
 ///@{
     void setDisplayedMessageLevelsMask(MessageLevels mask);
@@ -108,6 +142,8 @@ private:
     MessageCategories     m_displayedMessageCategoriesMask;
     MessageLevels         m_displayedMessageLevelsMask;
     MessageViewItemFields m_displayedMessageViewItemFields;
+    MessageFieldKey       m_filteredMessageFieldKey;
+    MessageFieldPredicate m_messageFieldPredicate;
 };
 
 }; // namespace Draupnir::Logging
@@ -33,6 +33,8 @@
 // Core things
 #include "draupnir/settings_registry/SettingsRegistryTemplate.h"  // IWYU pragma: keep
 #include "draupnir/settings_registry/SettingsBundleTemplate.h"    // IWYU pragma: keep
+#include "draupnir/settings_registry/SettingsSnapshotTemplate.h"  // IWYU pragma: keep
+#include "draupnir/settings_registry/ConcurrentSettingsRegistryTemplate.h" // IWYU pragma: keep
 
 // To work with SettingTraits
 #include "draupnir/settings_registry/utils/SettingsTraitsConcatenator.h" // IWYU pragma: keep
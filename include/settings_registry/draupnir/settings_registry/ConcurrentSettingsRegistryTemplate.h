@@ -0,0 +1,132 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef CONCURRENTSETTINGSREGISTRYTEMPLATE_H
+#define CONCURRENTSETTINGSREGISTRYTEMPLATE_H
+
+#include <array>
+#include <memory>
+#include <tuple>
+
+#include "draupnir/settings_registry/SettingsRegistryTemplate.h"
+#include "draupnir/settings_registry/core/ConcurrentValueTemplate.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class ConcurrentSettingsRegistryTemplate draupnir/settings_registry/ConcurrentSettingsRegistryTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief Variant of @ref Draupnir::Settings::SettingsRegistryTemplate which values can be read from worker threads.
+ *  @tparam Traits A variadic list of SettingTraits.
+ *
+ *  @details Registry itself (including `get`, `set`, bundles and backend access) still belongs to the thread it lives in.
+ *           Additionally every value read from the backend or changed within that thread is published into a
+ *           @ref Draupnir::Settings::ConcurrentValueTemplate, from which any thread can read it with @ref load or
+ *           @ref snapshot without bouncing to the owner thread. Small trivially-copyable values are published within
+ *           atomics or sequence locks and are read lock-free, other values (e.g. `QStringList` of the
+ *           @ref Draupnir::Settings::RecentFileListSetting) - within immutable snapshots replaced on each change, which
+ *           pointer is copied under a short mutex.
+ *
+ *           Usage:
+ *           @code
+ *           // GUI thread
+ *           registry.template set<WindowSizeSetting>(QSize{800,600});
+ *
+ *           // Worker thread
+ *           const QSize size = registry.template load<WindowSizeSetting>();
+ *           const auto files = registry.template snapshot<RecentFileListSetting>();
+ *           @endcode
+ *
+ * @note In lazy loading mode worker threads observe default value of the setting until it is read from the backend within
+ *       the owner thread. */
+
+template<SettingTraitConcept... Traits>
+class ConcurrentSettingsRegistryTemplate final : public SettingsRegistryTemplate<Traits...>
+{
+    using Base = SettingsRegistryTemplate<Traits...>;
+
+public:
+    /*! @brief Default constructor. Publishes default values of all settings. */
+    ConcurrentSettingsRegistryTemplate() :
+        m_published{Traits::defaultValue()...}
+    {}
+
+    Q_DISABLE_COPY(ConcurrentSettingsRegistryTemplate);
+
+    using Base::snapshot;
+
+    /*! @brief Returns copy of the last published value of the SettingTrait. This method is thread-safe. It is lock-free
+     *         unless the value is published as a snapshot (see @ref Draupnir::Settings::ConcurrentValueKind::Snapshot).
+     *  @tparam SettingTrait Trait present in the registry. */
+    template<SettingTraitConcept SettingTrait>
+    typename SettingTrait::Value load() const {
+        return _published<SettingTrait>().load();
+    }
+
+    /*! @brief Returns immutable snapshot of the last published value of the SettingTrait without copying the value. This method
+     *         is thread-safe.
+     *  @tparam SettingTrait Trait present in the registry, which value is published as a snapshot
+     *          (see @ref Draupnir::Settings::ConcurrentValueKind::Snapshot). */
+    template<SettingTraitConcept SettingTrait>
+    std::shared_ptr<const typename SettingTrait::Value> snapshot() const
+        requires(ConcurrentValueTemplate<typename SettingTrait::Value>::kind == ConcurrentValueKind::Snapshot)
+    {
+        return _published<SettingTrait>().snapshot();
+    }
+
+    /*! @brief Returns strategy used to publish values of the SettingTrait. */
+    template<SettingTraitConcept SettingTrait>
+    static constexpr ConcurrentValueKind publishingKind() {
+        return ConcurrentValueTemplate<typename SettingTrait::Value>::kind;
+    }
+
+protected:
+    /*! @brief Publishes updated value of the trait with provided index. */
+    void settingUpdated(std::size_t registryIndex) const final {
+        using Publisher = void(*)(const ConcurrentSettingsRegistryTemplate*);
+        static constexpr std::array<Publisher,sizeof...(Traits)> publishers{
+            [](const ConcurrentSettingsRegistryTemplate* registry) {
+                registry->template _published<Traits>().store(registry->template get<Traits>());
+            }...
+        };
+
+        publishers[registryIndex](this);
+    }
+
+private:
+    mutable std::tuple<ConcurrentValueTemplate<typename Traits::Value>...> m_published;  ///< Values visible to other threads.
+
+    /*! @brief Returns published storage of the SettingTrait. */
+    template<SettingTraitConcept SettingTrait>
+    ConcurrentValueTemplate<typename SettingTrait::Value>& _published() const {
+        static_assert(Base::template contains<SettingTrait>(),
+                "SettingTrait specified is not registered within this SettingsRegistry.");
+        return std::get<draupnir::utils::index_of_v<SettingTrait,Traits...>>(m_published);
+    }
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // CONCURRENTSETTINGSREGISTRYTEMPLATE_H
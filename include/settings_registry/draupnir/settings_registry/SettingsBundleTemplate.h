@@ -25,6 +25,7 @@
 #ifndef SETTINGSBUNDLETEMPLATE_H
 #define SETTINGSBUNDLETEMPLATE_H
 
+#include <array>
 #include <iostream>
 #include <tuple>
 
@@ -33,8 +34,10 @@
 #include "draupnir/settings_registry/concepts/SettingsBundleConcept.h"
 #include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
 #include "draupnir/settings_registry/core/SettingTemplate.h"
+#include "draupnir/settings_registry/core/SettingsWriteBehindInterface.h"
 #include "draupnir/settings_registry/utils/SettingTraitPrinter.h"
 #include "draupnir/settings_registry/utils/SettingTraitSerializer.h"
+#include "draupnir/utils/index_of.h"
 #include "draupnir/utils/type_presense.h"
 
 #if defined(DRAUPNIR_SETTINGS_USE_QSETTINGS)
@@ -56,7 +59,9 @@ namespace Draupnir::Settings
  *  @details A SettingsBundleTemplate represents a scoped subset of SettingTraits collected from a SettingsRegistryTemplate.
  *           It provides:
  *           - Type-safe access to settings values (get/set);
- *           - Persistence into the backend via SettingTraitSerializer;
+ *           - Persistence into the backend via SettingTraitSerializer. If write-behind mode of the registry which created
+ *             this bundle is enabled (see SettingsRegistryTemplate::setWriteBehindEnabled), changed values are written
+ *             to the backend by the registry in batches;
  *           - Validation utilities (isLoaded/isValid);
  *           - Debug printing of all registered keys and values.
  *
@@ -137,7 +142,9 @@ public:
      * @note Backend pointer is nullptr and working with such bundle will result in Q_ASSERT in Debug or UB in release. */
     SettingsBundleTemplate() :
         p_backend{nullptr},
-        m_settingTemplatePtrTuple{ (static_cast<SettingTemplate<SettingTraits>*>(nullptr))... }
+        p_writeBehind{nullptr},
+        m_settingTemplatePtrTuple{ (static_cast<SettingTemplate<SettingTraits>*>(nullptr))... },
+        m_registryIndices{}
     {}
 
     /*! @brief Checks whether the bundle has been bound to backend.
@@ -174,6 +181,7 @@ public:
                    "This bundle must have been initialized from corresponding SettingsRegistry.");
 
         Bundle result{p_backend};
+        result.setWriteBehind(p_writeBehind);
         _populateSettingBundle<Bundle,SettingTraits...>(result);
         return result;
     }
@@ -215,7 +223,16 @@ public:
                    "Backend pointer was not set.");
 
         std::get<SettingTemplate<Trait>*>(m_settingTemplatePtrTuple)->value = value;
+
+        constexpr std::size_t index = draupnir::utils::index_of_v<Trait,SettingTraits...>;
+        if (p_writeBehind && p_writeBehind->settingChanged(m_registryIndices[index]))
+            return;
+
         SettingTraitSerializer<Backend,Trait>::set(p_backend, value);
+#if defined(DRAUPNIR_SETTINGS_USE_CUSTOM)
+        if (const auto committed = p_backend->commit(); !committed)
+            qWarning() << "SettingsBundle: failed to commit settings:" << committed.error();
+#endif // DRAUPNIR_SETTINGS_USE_CUSTOM
     }
 
 protected:
@@ -232,38 +249,68 @@ protected:
      *  @param settings Pointer to the shared backend. */
     SettingsBundleTemplate(Backend* backend) :
         p_backend{backend},
-        m_settingTemplatePtrTuple{ (static_cast<SettingTemplate<SettingTraits>*>(nullptr))... }
+        p_writeBehind{nullptr},
+        m_settingTemplatePtrTuple{ (static_cast<SettingTemplate<SettingTraits>*>(nullptr))... },
+        m_registryIndices{}
     {
         Q_ASSERT_X(backend,"SettingsBundle::SettingsBundle",
                    "Provided backend pointer is nullptr.");
     }
 
-    /*! @brief Registers a setting by pointer (called by SettingsRegistry).
+    /*! @brief Registers a setting by pointer (called by test mocks). Such bundle has no registry indices, so it must not
+     *         defer writes through a @ref SettingsWriteBehindInterface.
      *  @tparam Trait Must be a trait declared in this bundle.
-     *  @param setting Pointer to SettingTemplate<Trait> owned by SettingsRegistry. */
+     *  @param setting Pointer to SettingTemplate<Trait> owned by the caller. */
     template<SettingTraitConcept Trait>
     void registerSetting(SettingTemplate<Trait>* setting) {
+        static_assert(contains<Trait>(),
+                      "Specified Trait is not contained within this SettingBundle.");
+        Q_ASSERT_X(p_writeBehind == nullptr, "SettingsBundle::registerSetting",
+                   "Bundles with write-behind must register settings together with their registry index.");
+
+        std::get<SettingTemplate<Trait>*>(m_settingTemplatePtrTuple) = setting;
+    }
+
+    /*! @brief Registers a setting by pointer together with its index within the registry (called by SettingsRegistry).
+     *  @tparam Trait Must be a trait declared in this bundle.
+     *  @param setting Pointer to SettingTemplate<Trait> owned by SettingsRegistry.
+     *  @param registryIndex Index of the Trait within the registry, reported to the @ref SettingsWriteBehindInterface. */
+    template<SettingTraitConcept Trait>
+    void registerSetting(SettingTemplate<Trait>* setting, std::size_t registryIndex) {
         static_assert(contains<Trait>(),
                       "Specified Trait is not contained within this SettingBundle.");
 
         std::get<SettingTemplate<Trait>*>(m_settingTemplatePtrTuple) = setting;
+        m_registryIndices[draupnir::utils::index_of_v<Trait,SettingTraits...>] = registryIndex;
     }
 
+    /*! @brief Sets object, which decides whether writes to the backend are deferred (called by SettingsRegistry). */
+    void setWriteBehind(SettingsWriteBehindInterface* writeBehind) { p_writeBehind = writeBehind; }
+
 private:
     friend class SettingsBundleTemplateTest;
 
     /*! @brief Pointer to the backend settings store. */
     Backend* p_backend;
 
+    /*! @brief Non-owning pointer to the registry's write-behind queue. `nullptr` for bundles not created by a registry. */
+    SettingsWriteBehindInterface* p_writeBehind;
+
     /*! @brief Tuple of non-owning pointers to AbstractSetting<Trait> for each registered trait. */
     SettingTemplatePtrTuple m_settingTemplatePtrTuple;
 
+    /*! @brief Indices of the traits within the registry this bundle was created from. */
+    std::array<std::size_t,sizeof...(SettingTraits)> m_registryIndices;
+
     /*! @brief Populates a SettingsBundle by assigning internal trait pointers.
      *  @tparam Bundle Target bundle type. */
     template<class Bundle,class First, class... Rest>
     inline void _populateSettingBundle(Bundle& bundle) {
         if constexpr (Bundle::template contains<First>()) {
-            bundle.registerSetting(std::get<SettingTemplate<First>*>(m_settingTemplatePtrTuple));
+            bundle.registerSetting(
+                std::get<SettingTemplate<First>*>(m_settingTemplatePtrTuple),
+                m_registryIndices[draupnir::utils::index_of_v<First,SettingTraits...>]
+            );
         }
 
         if constexpr (sizeof...(Rest) > 0)
@@ -341,6 +388,8 @@ protected:
     friend class SettingsRegistryTemplate;
 
     SettingsBundleTemplate(Backend*) {};
+
+    void setWriteBehind(SettingsWriteBehindInterface*) {}
 };
 
 }; // namespace Draupnir::Settings
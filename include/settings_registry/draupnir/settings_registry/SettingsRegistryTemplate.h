@@ -26,6 +26,17 @@
 #define SETTINGSREGISTRYTEMPLATE_H
 
 #include <QDebug>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QPointer>
+#include <QTimer>
+
+#include <bitset>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 #if defined(DRAUPNIR_SETTINGS_USE_QSETTINGS)
     #include <QSettings>
@@ -36,9 +47,13 @@
 #endif
 
 #include "draupnir/settings_registry/SettingsBundleTemplate.h"
+#include "draupnir/settings_registry/SettingsSnapshotTemplate.h"
 #include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
 #include "draupnir/settings_registry/core/SettingTemplate.h"
+#include "draupnir/settings_registry/core/SettingsWriteBehindInterface.h"
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
 #include "draupnir/settings_registry/utils/SettingTraitSerializer.h"
+#include "draupnir/utils/index_of.h"
 #include "draupnir/utils/type_presense.h"
 
 namespace Draupnir::Settings
@@ -54,13 +69,34 @@ namespace Draupnir::Settings
  *             macro (DRAUPNIR_SETTINGS_USE_QSETTINGS or DRAUPNIR_SETTINGS_USE_APPSETTINGS);
  *           - Type-safe accessors and mutators for individual setting values;
  *           - Construction of partial bundles for selected traits;
- *           - Compile-time membership checks.
+ *           - Compile-time membership checks;
+ *           - Optional write-behind mode (see @ref setWriteBehindEnabled). In this mode `set` calls made on the registry or on
+ *             any bundle created by it only mark the trait as dirty within a compile-time sized bitset. Dirty values are
+ *             written to the backend in one batch by @ref commit, which is called on a timer, explicitly or when the
+ *             registry is destroyed;
+ *           - Optional lazy loading (see @ref setLazyLoadingEnabled). In this mode nothing is read from the backend when it is
+ *             attached. Each setting is read on first @ref get call or when a bundle containing it is created, which is
+ *             tracked by a compile-time sized bitset. So startup cost depends only on settings actually used at startup;
+ *           - Change notifications (see @ref subscribe). Listeners are kept in per-trait lists resolved at compile time. Changes
+ *             made on the registry or on any bundle created by it are collected within a bitset and delivered once per event
+ *             loop turn, so several successive `set` calls of the same trait result in a single notification with the latest
+ *             value;
+ *           - Optional hot reload (see @ref setHotReloadEnabled). The file backing the backend is watched and, when changed on
+ *             disk, each loaded setting is read again and compared with its in-memory value. Only settings which values
+ *             actually differ are updated and reported to subscribers;
+ *           - Snapshots of all values (see @ref snapshot and @ref restore). Restoring a snapshot updates only the settings
+ *             which differ from it and persists them in one batch, so switching between configuration profiles costs
+ *             O(changed settings) backend writes.
  *
  *           Each SettingTrait must define:
  *           - `using Value` — the C++ value type (e.g. bool, QString, enum, ...);
- *           - `static QString key()` — persistent key in the backend;
+ *           - `static constexpr std::string_view keyView()` or `static QString key()` — persistent key in the backend;
  *           - `static Value defaultValue()` — default value when no stored value exists.
  *
+ *           When all traits declare `keyView()`, a static perfect-hash table from key to trait index is built at compile
+ *           time. It is available through @ref indexOfKey and @ref visitTraitByKey and allows generic tooling (e.g. import
+ *           and export of settings) to dispatch keys to traits without allocations.
+ *
  *           SettingsRegistryTemplate can work with the following backends:
  *           - QSettings. To enable QSettings - define somewhere in the *.pro file DRAUPNIR_SETTINGS_USE_QSETTINGS macro.
  *             Next QSettings can be configured in standart Qt-way by using static methods available within the QCoreApplication:
@@ -84,7 +120,7 @@ namespace Draupnir::Settings
  * @todo Question: Maybe backends can be specifyed by the template arguments + specializations?*/
 
 template<SettingTraitConcept... Traits>
-class SettingsRegistryTemplate
+class SettingsRegistryTemplate : private SettingsWriteBehindInterface
 {
 #if defined(DRAUPNIR_SETTINGS_USE_QSETTINGS)
     using Backend = QSettings;
@@ -125,14 +161,62 @@ public:
     /*! @brief Static constexpr variable containing `true` if this @ref SettingsRegistryTemplate instantiation is empty. */
     static constexpr bool isEmpty_v = isEmpty();
 
+    /*! @brief Returns `true` if all traits of this registry declare compile-time keys (`static constexpr keyView()`). */
+    static constexpr bool hasConstexprKeys() { return (SettingTrait::HasConstexprKey<Traits> && ...); }
+
+    /*! @brief Returns index of the trait with provided key within this registry or `std::nullopt` if there is no such trait.
+     *         Lookup is done within the compile-time perfect-hash table and does not allocate.
+     * @note This method is available only when all traits declare compile-time keys. */
+    static constexpr std::optional<std::size_t> indexOfKey(std::string_view key) requires(hasConstexprKeys()) {
+        return _KeyTable<>::table.find(key);
+    }
+
+    /*! @brief Finds trait with provided key and calls `visitor.template operator()<Trait>()` for it.
+     *  @param key Setting key.
+     *  @param visitor Callable object with templated call operator accepting trait as a template argument.
+     *  @return `true` if the trait was found and the visitor was called; `false` otherwise.
+     * @note This method is available only when all traits declare compile-time keys. */
+    template<class Visitor>
+    static bool visitTraitByKey(std::string_view key, Visitor&& visitor) requires(hasConstexprKeys()) {
+        using Handler = void(*)(Visitor&);
+        static constexpr std::array<Handler,sizeof...(Traits)> handlers{
+            [](Visitor& target) { target.template operator()<Traits>(); }...
+        };
+
+        const std::optional<std::size_t> index = indexOfKey(key);
+        if (!index)
+            return false;
+
+        handlers[*index](visitor);
+        return true;
+    }
+
+    /*! @brief Value type holding copies of all settings of this registry. See @ref snapshot and @ref restore. */
+    using Snapshot = SettingsSnapshotTemplate<Traits...>;
+
+    /*! @brief Identifier of the subscription returned by @ref subscribe. Valid identifiers are never `0`. */
+    using SubscriptionId = quint64;
+
     /*! @brief Default constructor. Initializes internal Backend pointer to nullptr. */
     SettingsRegistryTemplate() :
-        p_backend{nullptr}
+        p_backend{nullptr},
+        p_flushTimer{nullptr},
+        m_flushInterval{1000},
+        p_notifyTimer{nullptr},
+        m_nextSubscriptionId{1},
+        p_fileWatcher{nullptr}
     {}
 
-    /*! @brief Destructor. When using QSettings or AppSettings as backend - will delete internally created backend. When
-     *         using DRAUPNIR_SETTINGS_USE_CUSTOM - will do nothing. */
-    ~SettingsRegistryTemplate() {
+    Q_DISABLE_COPY(SettingsRegistryTemplate);
+
+    /*! @brief Destructor. Writes pending changes of the write-behind mode to the backend. When using QSettings or AppSettings
+     *         as backend - will delete internally created backend. When using DRAUPNIR_SETTINGS_USE_CUSTOM - will not delete
+     *         the backend. */
+    ~SettingsRegistryTemplate() override {
+        commit();
+        delete p_flushTimer;
+        delete p_notifyTimer;
+        delete p_fileWatcher;
 #if !defined(DRAUPNIR_SETTINGS_USE_CUSTOM)
         delete p_backend;
 #endif
@@ -146,7 +230,8 @@ public:
         QSettings::setDefaultFormat(QSettings::NativeFormat);
         p_backend = new Backend;
 
-        _loadSettingsImpl<0>();
+        if (!m_lazyLoading)
+            _loadSettingsImpl(std::index_sequence_for<Traits...>{});
     }
 #endif
 
@@ -165,7 +250,8 @@ public:
 
         p_backend = backend;
 
-        _loadSettingsImpl<0>();
+        if (!m_lazyLoading)
+            _loadSettingsImpl(std::index_sequence_for<Traits...>{});
     }
 #endif
 
@@ -188,6 +274,210 @@ public:
     /*! @brief Returns the pointer to the enabled Backend. */
     Backend* settings() { return p_backend; }
 
+///@name Lazy loading
+///@{
+    /*! @brief Enables or disables lazy loading. When enabled, settings are read from the backend on first access instead of
+     *         reading all of them when the backend is attached.
+     * @note This method must be called before the backend is attached (see `loadSettings` / `setBackend`). */
+    void setLazyLoadingEnabled(bool enabled) {
+        Q_ASSERT_X(p_backend == nullptr, "SettingsRegistryTemplate::setLazyLoadingEnabled",
+                   "This method must be called before the backend is attached.");
+        m_lazyLoading = enabled;
+    }
+
+    /*! @brief Returns `true` if lazy loading is enabled. */
+    bool isLazyLoadingEnabled() const { return m_lazyLoading; }
+
+    /*! @brief Returns `true` if the value of the SettingTrait was already read from the backend or was set explicitly. */
+    template<SettingTraitConcept SettingTrait>
+    bool isSettingLoaded() const {
+        static_assert(contains<SettingTrait>(),
+                "SettingTrait specified is not registered within this SettingsRegistry.");
+        return m_loadedTraits.test(draupnir::utils::index_of_v<SettingTrait,Traits...>);
+    }
+///@}
+
+///@name Write-behind mode
+///@{
+    /*! @brief Enables or disables write-behind mode. When disabling, pending changes are written to the backend immediately.
+     * @note Timer-based flushing requires running Qt event loop in the thread of this registry. */
+    void setWriteBehindEnabled(bool enabled) {
+        if (!enabled)
+            commit();
+        m_writeBehindEnabled = enabled;
+    }
+
+    /*! @brief Returns `true` if write-behind mode is enabled. */
+    bool isWriteBehindEnabled() const { return m_writeBehindEnabled; }
+
+    /*! @brief Sets delay (in milliseconds) between the first deferred change and writing all pending changes to the backend.
+     *         Default is 1000 ms. */
+    void setWriteBehindInterval(int msec) {
+        Q_ASSERT_X(msec >= 0, "SettingsRegistryTemplate::setWriteBehindInterval",
+                   "Interval must not be negative.");
+        m_flushInterval = msec;
+        if (p_flushTimer)
+            p_flushTimer->setInterval(msec);
+    }
+
+    /*! @brief Returns delay (in milliseconds) between the first deferred change and writing pending changes to the backend. */
+    int writeBehindInterval() const { return m_flushInterval; }
+
+    /*! @brief Returns `true` if there are changes which were not yet written to the backend. */
+    bool hasPendingWrites() const { return m_dirtyTraits.any(); }
+
+    /*! @brief Returns `true` if the value of the SettingTrait was changed but not yet written to the backend. */
+    template<SettingTraitConcept SettingTrait>
+    bool isPendingWrite() const {
+        static_assert(contains<SettingTrait>(),
+                "SettingTrait specified is not registered within this SettingsRegistry.");
+        return m_dirtyTraits.test(draupnir::utils::index_of_v<SettingTrait,Traits...>);
+    }
+
+    /*! @brief Writes all pending changes to the backend in one batch. Does nothing if there are no pending changes. */
+    void commit() {
+        if (p_flushTimer)
+            p_flushTimer->stop();
+        if (m_dirtyTraits.none())
+            return;
+
+        Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::commit",
+                   "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
+        _commitImpl(std::index_sequence_for<Traits...>{});
+        m_dirtyTraits.reset();
+        _commitBackend();
+    }
+///@}
+
+///@name Change notifications
+///@{
+    /*! @brief Subscribes to changes of the SettingTrait value.
+     *  @tparam SettingTrait Trait present in the registry.
+     *  @param callback Callable invoked with the new value. Called from the event loop of the registry's thread, once per
+     *         event loop turn regardless of how many times the value was changed within it.
+     *  @return Identifier which can be passed to @ref unsubscribe. */
+    template<SettingTraitConcept SettingTrait>
+    SubscriptionId subscribe(std::function<void(const typename SettingTrait::Value&)> callback) {
+        return _subscribe<SettingTrait>(nullptr, std::move(callback));
+    }
+
+    /*! @brief Subscribes to changes of the SettingTrait value for the lifetime of the `context` object.
+     *  @tparam SettingTrait Trait present in the registry.
+     *  @param context Object, destruction of which cancels the subscription. Must not be `nullptr`.
+     *  @param callback Callable invoked with the new value.
+     *  @return Identifier which can be passed to @ref unsubscribe. */
+    template<SettingTraitConcept SettingTrait>
+    SubscriptionId subscribe(QObject* context, std::function<void(const typename SettingTrait::Value&)> callback) {
+        Q_ASSERT_X(context, "SettingsRegistryTemplate::subscribe<SettingTrait>",
+                   "Provided context pointer is nullptr.");
+        return _subscribe<SettingTrait>(context, std::move(callback));
+    }
+
+    /*! @brief Cancels subscription with the provided identifier.
+     *  @return `true` if the subscription was found and removed; `false` otherwise. */
+    bool unsubscribe(SubscriptionId id) {
+        return _unsubscribeImpl(id, std::index_sequence_for<Traits...>{});
+    }
+
+    /*! @brief Returns amount of subscriptions to the SettingTrait changes. */
+    template<SettingTraitConcept SettingTrait>
+    int subscriberCount() const {
+        static_assert(contains<SettingTrait>(),
+                "SettingTrait specified is not registered within this SettingsRegistry.");
+        return static_cast<int>(std::get<draupnir::utils::index_of_v<SettingTrait,Traits...>>(m_listeners).size());
+    }
+
+    /*! @brief Returns `true` if there are changes which subscribers were not yet notified about. */
+    bool hasPendingNotifications() const { return m_changedTraits.any(); }
+
+    /*! @brief Notifies subscribers about pending changes immediately instead of waiting for the event loop. */
+    void flushNotifications() {
+        if (p_notifyTimer)
+            p_notifyTimer->stop();
+        if (m_changedTraits.none())
+            return;
+
+        const std::bitset<sizeof...(Traits)> changed = m_changedTraits;
+        m_changedTraits.reset();
+        _notifyImpl(changed, std::index_sequence_for<Traits...>{});
+    }
+///@}
+
+///@name Hot reload
+///@{
+    /*! @brief Enables or disables watching of the file backing the settings backend. When the file changes, @ref reloadSettings
+     *         is called.
+     *  @return `true` on success; `false` if the backend is not backed by a file or the file can not be watched.
+     * @note Backend must be attached before calling this method. */
+    bool setHotReloadEnabled(bool enabled) {
+        Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::setHotReloadEnabled",
+                   "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
+        if (!enabled) {
+            delete p_fileWatcher;
+            p_fileWatcher = nullptr;
+            return true;
+        }
+
+        const QString fileName = p_backend->fileName();
+        if (fileName.isEmpty() || !QFileInfo::exists(fileName))
+            return false;
+
+        if (p_fileWatcher == nullptr) {
+            p_fileWatcher = new QFileSystemWatcher;
+            QObject::connect(p_fileWatcher, &QFileSystemWatcher::fileChanged, p_fileWatcher, [this](const QString& path) {
+                reloadSettings();
+                // Files replaced by rename (editors, QSaveFile) drop out of the watcher, so watch the new file.
+                if (!p_fileWatcher->files().contains(path) && QFileInfo::exists(path))
+                    p_fileWatcher->addPath(path);
+            });
+        }
+        return p_fileWatcher->files().contains(fileName) || p_fileWatcher->addPath(fileName);
+    }
+
+    /*! @brief Returns `true` if hot reload is enabled. */
+    bool isHotReloadEnabled() const { return p_fileWatcher != nullptr; }
+
+    /*! @brief Re-reads the backend storage and applies values which differ from in-memory ones. Settings which were not loaded
+     *         yet (lazy mode) or have pending writes (write-behind mode) are skipped. Changed settings are reported to
+     *         subscribers, but not written back to the backend.
+     *  @return Amount of settings which values were changed. */
+    int reloadSettings() {
+        Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::reloadSettings",
+                   "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
+#if defined(DRAUPNIR_SETTINGS_USE_CUSTOM)
+        p_backend->reload();
+#else
+        p_backend->sync();
+#endif
+        return _reloadImpl(std::index_sequence_for<Traits...>{});
+    }
+///@}
+
+///@name Snapshots
+///@{
+    /*! @brief Returns copy of the values of all settings. In lazy mode settings not loaded yet are read from the backend. */
+    Snapshot snapshot() const {
+        Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::snapshot",
+                   "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
+        Snapshot result;
+        _snapshotImpl(result, std::index_sequence_for<Traits...>{});
+        return result;
+    }
+
+    /*! @brief Applies values from the snapshot. Only settings which differ from the snapshot are changed and reported to
+     *         subscribers. Changed settings are written to the backend in one batch: immediately or, in write-behind mode,
+     *         by the next @ref commit.
+     *  @return Amount of settings which values were changed. */
+    int restore(const Snapshot& snapshot) {
+        Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::restore",
+                   "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
+        const int changed = _restoreImpl(snapshot, std::index_sequence_for<Traits...>{});
+        if (!m_writeBehindEnabled)
+            commit();
+        return changed;
+    }
+///@}
+
     /*! @brief Prints all settings in the registry to an arbitrary output stream-like object.
      *  @tparam Output Stream-like type that supports `operator<<` for the emitted pieces.
      *  @param output  Output sink (e.g. `QDebug` from `qDebug()/qInfo()`).
@@ -211,7 +501,8 @@ public:
                    "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
 
         Bundle result{p_backend};
-        _populateSettingBundle<Bundle,0>(result);
+        result.setWriteBehind(this);
+        _populateSettingBundle<Bundle>(result, std::index_sequence_for<Traits...>{});
         return result;
     };
 
@@ -237,10 +528,12 @@ public:
                 "SettingTrait specified is not registered within this SettingsRegistry.");
         Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::get<SettingTrait>",
                    "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
-        return std::get<SettingTemplate<SettingTrait>>(m_settings).value;
+        constexpr std::size_t index = draupnir::utils::index_of_v<SettingTrait,Traits...>;
+        _ensureLoaded<index>();
+        return std::get<index>(m_settings).value;
     }
 
-    /*! @brief Sets and persists a new value for a specific setting.
+    /*! @brief Sets and persists a new value for a specific setting. In write-behind mode the value is persisted later.
      *  @tparam SettingTrait Trait present in the registry.
      *  @param value New value to store and persist. */
     template<SettingTraitConcept SettingTrait>
@@ -249,13 +542,234 @@ public:
                 "SettingTrait specified is not registered within this SettingsRegistry.");
         Q_ASSERT_X(p_backend, "SettingsRegistry<SettingTraits...>::set<SettingTrait>",
                    "SettingsRegistry<SettingTraits...>::loadSettings method must have been called before.");
-        std::get<SettingTemplate<SettingTrait>>(m_settings).value = value;
+        constexpr std::size_t index = draupnir::utils::index_of_v<SettingTrait,Traits...>;
+        std::get<index>(m_settings).value = value;
+        m_loadedTraits.set(index);
+
+        if (settingChanged(index))
+            return;
+
         SettingTraitSerializer<Backend,SettingTrait>::set(p_backend, value);
+        _commitBackend();
     }
 
+protected:
+    /*! @brief Called after the in-memory value of the trait with provided index was read from the backend or changed on
+     *         the registry or on any bundle created by it. Allows derived registries (e.g.
+     *         @ref Draupnir::Settings::ConcurrentSettingsRegistryTemplate) to mirror values. Default implementation does
+     *         nothing.
+     *  @param registryIndex Index of the setting trait within this registry. */
+    virtual void settingUpdated(std::size_t registryIndex) const { Q_UNUSED(registryIndex); }
+
 private:
-    Backend* p_backend;                ///< Backend used for storage.
-    AbstractSettingsTuple m_settings;  ///< Tuple of AbstractSetting<Trait> instances.
+    Backend* p_backend;                        ///< Backend used for storage.
+    mutable AbstractSettingsTuple m_settings;  ///< Tuple of AbstractSetting<Trait> instances. Filled on demand in lazy mode.
+
+    mutable std::bitset<sizeof...(Traits)> m_loadedTraits;  ///< Traits which values were read from backend or set.
+    bool m_lazyLoading = false;                             ///< `true` if lazy loading is enabled.
+
+    std::bitset<sizeof...(Traits)> m_dirtyTraits;  ///< Traits changed in write-behind mode and not yet written to backend.
+    bool m_writeBehindEnabled = false;             ///< `true` if write-behind mode is enabled.
+    QTimer* p_flushTimer;                          ///< Single-shot timer calling commit(). Created on first deferred write.
+    int m_flushInterval;                           ///< Interval of p_flushTimer in milliseconds.
+
+    /*! @brief Single subscription to changes of the Trait value. */
+    template<SettingTraitConcept Trait>
+    struct _Listener {
+        SubscriptionId id;
+        QPointer<QObject> context;
+        bool hasContext;
+        std::function<void(const typename Trait::Value&)> callback;
+    };
+
+    std::tuple<std::vector<_Listener<Traits>>...> m_listeners;  ///< Per-trait subscriber lists.
+    std::bitset<sizeof...(Traits)> m_subscribedTraits;          ///< Traits which have at least one subscriber.
+    std::bitset<sizeof...(Traits)> m_changedTraits;             ///< Traits changed since the last notification.
+    QTimer* p_notifyTimer;                                      ///< Zero-interval timer calling flushNotifications().
+    SubscriptionId m_nextSubscriptionId;                        ///< Identifier of the next subscription.
+
+    QFileSystemWatcher* p_fileWatcher;  ///< Watcher of the file backing the backend. Exists only while hot reload is enabled.
+
+    /*! @brief Implementation of @ref SettingsWriteBehindInterface. Publishes the value through @ref settingUpdated and
+     *         schedules change notification. In write-behind mode also marks trait as dirty and schedules @ref commit. */
+    bool settingChanged(std::size_t registryIndex) final {
+        settingUpdated(registryIndex);
+        _scheduleNotification(registryIndex);
+
+        if (!m_writeBehindEnabled)
+            return false;
+
+        m_dirtyTraits.set(registryIndex);
+        if (p_flushTimer == nullptr) {
+            p_flushTimer = new QTimer;
+            p_flushTimer->setSingleShot(true);
+            p_flushTimer->setInterval(m_flushInterval);
+            QObject::connect(p_flushTimer, &QTimer::timeout, p_flushTimer, [this]() { commit(); });
+        }
+        if (!p_flushTimer->isActive())
+            p_flushTimer->start();
+        return true;
+    }
+
+    /*! @brief Persists values written to the custom backend (see @ref SettingsBackendInterface::commit). QSettings and
+     *         AppSettings persist values on their own. Errors are reported by qWarning. */
+    void _commitBackend() {
+#if defined(DRAUPNIR_SETTINGS_USE_CUSTOM)
+        if (const auto committed = p_backend->commit(); !committed)
+            qWarning() << "SettingsRegistry: failed to commit settings:" << committed.error();
+#endif
+    }
+
+    /*! @brief Marks trait as changed and schedules @ref flushNotifications if the trait has subscribers. */
+    void _scheduleNotification(std::size_t registryIndex) {
+        if (!m_subscribedTraits.test(registryIndex))
+            return;
+
+        m_changedTraits.set(registryIndex);
+        if (p_notifyTimer == nullptr) {
+            p_notifyTimer = new QTimer;
+            p_notifyTimer->setSingleShot(true);
+            p_notifyTimer->setInterval(0);
+            QObject::connect(p_notifyTimer, &QTimer::timeout, p_notifyTimer, [this]() { flushNotifications(); });
+        }
+        if (!p_notifyTimer->isActive())
+            p_notifyTimer->start();
+    }
+
+    /*! @brief Adds subscription to the list of the SettingTrait. */
+    template<SettingTraitConcept SettingTrait>
+    SubscriptionId _subscribe(QObject* context, std::function<void(const typename SettingTrait::Value&)> callback) {
+        static_assert(contains<SettingTrait>(),
+                "SettingTrait specified is not registered within this SettingsRegistry.");
+        Q_ASSERT_X(callback, "SettingsRegistryTemplate::subscribe<SettingTrait>",
+                   "Provided callback is empty.");
+        constexpr std::size_t index = draupnir::utils::index_of_v<SettingTrait,Traits...>;
+
+        const SubscriptionId id = m_nextSubscriptionId++;
+        std::get<index>(m_listeners).push_back(_Listener<SettingTrait>{id, context, context != nullptr, std::move(callback)});
+        m_subscribedTraits.set(index);
+        return id;
+    }
+
+    /*! @brief Removes subscription from whichever trait list contains it. */
+    template<std::size_t... Indices>
+    bool _unsubscribeImpl(SubscriptionId id, std::index_sequence<Indices...>) {
+        return (_unsubscribe<Indices>(id) || ...);
+    }
+
+    /*! @brief Removes subscription from the list of the trait with provided index. */
+    template<std::size_t Index>
+    bool _unsubscribe(SubscriptionId id) {
+        auto& listeners = std::get<Index>(m_listeners);
+        const auto removed = std::erase_if(listeners, [id](const auto& listener) { return listener.id == id; });
+        if (listeners.empty())
+            m_subscribedTraits.reset(Index);
+        return removed != 0;
+    }
+
+    /*! @brief Notifies subscribers of the changed traits. */
+    template<std::size_t... Indices>
+    void _notifyImpl(const std::bitset<sizeof...(Traits)>& changed, std::index_sequence<Indices...>) {
+        ((changed.test(Indices) ? _notify<Indices>() : void()), ...);
+    }
+
+    /*! @brief Calls subscribers of the trait with provided index. Subscriptions which context was destroyed are dropped.
+     *         Callbacks receive copies of the list and of the value, so they may freely (un)subscribe or change settings. */
+    template<std::size_t Index>
+    void _notify() {
+        auto& listeners = std::get<Index>(m_listeners);
+        std::erase_if(listeners, [](const auto& listener) { return listener.hasContext && listener.context.isNull(); });
+        if (listeners.empty()) {
+            m_subscribedTraits.reset(Index);
+            return;
+        }
+
+        const auto currentListeners = listeners;
+        const auto value = std::get<Index>(m_settings).value;
+        for (const auto& listener : currentListeners) {
+            if (listener.hasContext && listener.context.isNull())
+                continue;
+            listener.callback(value);
+        }
+    }
+
+    /*! @brief Reloads settings with provided indices. Returns amount of changed settings. */
+    template<std::size_t... Indices>
+    int _reloadImpl(std::index_sequence<Indices...>) {
+        return (static_cast<int>(_reloadSetting<Indices>()) + ... + 0);
+    }
+
+    /*! @brief Reads the setting with provided index from the backend and applies it if it differs from in-memory value.
+     *         Values of types without `operator==` are always applied. */
+    template<std::size_t Index>
+    bool _reloadSetting() {
+        if (!m_loadedTraits.test(Index) || m_dirtyTraits.test(Index))
+            return false;
+
+        using Trait = typename _TraitForIndex<Index>::type;
+        auto value = SettingTraitSerializer<Backend,Trait>::get(p_backend);
+        auto& current = std::get<Index>(m_settings).value;
+        if constexpr (std::equality_comparable<typename Trait::Value>) {
+            if (value == current)
+                return false;
+        }
+
+        current = std::move(value);
+        settingUpdated(Index);
+        _scheduleNotification(Index);
+        return true;
+    }
+
+    /*! @brief Copies values of the settings with provided indices into the snapshot. */
+    template<std::size_t... Indices>
+    void _snapshotImpl(Snapshot& snapshot, std::index_sequence<Indices...>) const {
+        ((_ensureLoaded<Indices>(),
+          snapshot.template set<typename _TraitForIndex<Indices>::type>(std::get<Indices>(m_settings).value)), ...);
+    }
+
+    /*! @brief Restores settings with provided indices. Returns amount of changed settings. */
+    template<std::size_t... Indices>
+    int _restoreImpl(const Snapshot& snapshot, std::index_sequence<Indices...>) {
+        return (static_cast<int>(_restoreSetting<Indices>(snapshot)) + ... + 0);
+    }
+
+    /*! @brief Applies value of the setting with provided index from the snapshot if it differs from in-memory value and
+     *         marks the setting as dirty. Settings not loaded yet are applied without reading the backend. */
+    template<std::size_t Index>
+    bool _restoreSetting(const Snapshot& snapshot) {
+        using Trait = typename _TraitForIndex<Index>::type;
+        const auto& value = snapshot.template get<Trait>();
+        auto& current = std::get<Index>(m_settings).value;
+        if constexpr (std::equality_comparable<typename Trait::Value>) {
+            if (m_loadedTraits.test(Index) && current == value)
+                return false;
+        }
+
+        current = value;
+        m_loadedTraits.set(Index);
+        if (!settingChanged(Index))
+            m_dirtyTraits.set(Index);
+        return true;
+    }
+
+    /*! @brief Writes values of dirty traits to the backend. */
+    template<std::size_t... Indices>
+    void _commitImpl(std::index_sequence<Indices...>) {
+        ((m_dirtyTraits.test(Indices) ?
+            SettingTraitSerializer<Backend,typename _TraitForIndex<Indices>::type>::set(p_backend, std::get<Indices>(m_settings).value) :
+            void()), ...);
+    }
+
+    /*! @brief Holder of the compile-time key table. Template, so the table is built only when it is used. */
+    template<class Unused = void>
+    struct _KeyTable {
+        static constexpr std::array<std::string_view,sizeof...(Traits)> keys{SettingTraitKey<Traits>::view...};
+
+        static_assert(!draupnir::utils::static_perfect_hash<sizeof...(Traits)>::has_duplicates(keys),
+                      "Setting traits of one registry must have distinct keys.");
+
+        static constexpr draupnir::utils::static_perfect_hash<sizeof...(Traits)> table{keys};
+    };
 
     /*! @brief Helper to extract the Trait type for a given tuple index. */
     template<std::size_t Index>
@@ -263,27 +777,40 @@ private:
         using type = typename std::tuple_element_t<Index,AbstractSettingsTuple>::Trait;
     };
 
-    /*! @brief Recursively loads all trait values from the AppSettings backend. */
-    template<std::size_t Index = 0>
-    inline void _loadSettingsImpl() {
+    /*! @brief Reads value of the trait with provided index from the backend if it was not loaded yet. */
+    template<std::size_t Index>
+    inline void _ensureLoaded() const {
+        if (Q_LIKELY(m_loadedTraits.test(Index)))
+            return;
+
         std::get<Index>(m_settings).value = SettingTraitSerializer<Backend,typename _TraitForIndex<Index>::type>::get(p_backend);
+        m_loadedTraits.set(Index);
+        settingUpdated(Index);
+    }
 
-        if constexpr (Index + 1 < std::tuple_size_v<AbstractSettingsTuple>)
-            _loadSettingsImpl<Index+1>();
+    /*! @brief Loads all trait values from the backend. Expanded as a fold rather than recursion, so registries with
+     *         many traits do not hit the template instantiation depth limit. */
+    template<std::size_t... Indices>
+    inline void _loadSettingsImpl(std::index_sequence<Indices...>) {
+        (_ensureLoaded<Indices>(), ...);
     }
 
     /*! @brief Populates a SettingsBundle by assigning internal trait pointers.
      *  @tparam Bundle Target bundle type. */
-    template<class Bundle,std::size_t Index = 0>
-    inline void _populateSettingBundle(Bundle& bundle) {
+    template<class Bundle,std::size_t... Indices>
+    inline void _populateSettingBundle(Bundle& bundle, std::index_sequence<Indices...>) {
+        (_populateSetting<Bundle,Indices>(bundle), ...);
+    }
+
+    /*! @brief Assigns pointer to the trait with provided index if the Bundle contains this trait. */
+    template<class Bundle,std::size_t Index>
+    inline void _populateSetting(Bundle& bundle) {
         using Trait = typename _TraitForIndex<Index>::type;
 
         if constexpr (Bundle::template contains<Trait>()) {
-            bundle.registerSetting(&std::get<SettingTemplate<Trait>>(m_settings));
+            _ensureLoaded<Index>();
+            bundle.registerSetting(&std::get<Index>(m_settings), Index);
         }
-
-        if constexpr (Index + 1 < std::tuple_size_v<AbstractSettingsTuple>)
-            _populateSettingBundle<Bundle,Index+1>(bundle);
     }
 };
 
@@ -0,0 +1,101 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SETTINGSSNAPSHOTTEMPLATE_H
+#define SETTINGSSNAPSHOTTEMPLATE_H
+
+#include <tuple>
+
+#include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
+#include "draupnir/utils/index_of.h"
+#include "draupnir/utils/type_presense.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class SettingsSnapshotTemplate draupnir/settings_registry/SettingsSnapshotTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief Owning copy of the values of settings described by the SettingTraits.
+ *  @tparam SettingTraits... Variadic list of `SettingTrait` types.
+ *
+ *  @details Snapshot is a plain value type: it is not connected to any backend and can be freely copied, stored and modified.
+ *           Snapshots of the registry state are created by SettingsRegistryTemplate::snapshot and applied back by
+ *           SettingsRegistryTemplate::restore, which updates and persists only the settings differing from the snapshot.
+ *           This allows keeping several configuration profiles in memory and switching between them cheaply.
+ *
+ *           Usage:
+ *           @code
+ *           using Registry = SettingsRegistryTemplate<ChunkSizeSetting, CompressionSetting>;
+ *
+ *           Registry::Snapshot lowBandwidth = registry.snapshot();
+ *           lowBandwidth.set<ChunkSizeSetting>(16 * 1024);
+ *           lowBandwidth.set<CompressionSetting>(true);
+ *
+ *           registry.restore(lowBandwidth);
+ *           @endcode */
+
+template<SettingTraitConcept... SettingTraits>
+class SettingsSnapshotTemplate
+{
+    using ValueTuple = std::tuple<typename SettingTraits::Value...>;
+
+public:
+    /*! @brief Constructor. Creates snapshot holding default values of all SettingTraits. */
+    SettingsSnapshotTemplate() :
+        m_values{SettingTraits::defaultValue()...}
+    {}
+
+    /*! @brief Checks at compile time whether the snapshot contains the given trait. */
+    template<SettingTraitConcept Trait>
+    static constexpr bool contains() { return draupnir::utils::is_one_of_v<Trait,SettingTraits...>; }
+
+    /*! @brief Returns value of the Trait stored within this snapshot.
+     *  @tparam Trait Must be one of the traits in the snapshot. */
+    template<SettingTraitConcept Trait>
+    const typename Trait::Value& get() const {
+        static_assert(contains<Trait>(),
+                "Specified Trait is not a member of SettingTraits... pack.");
+        return std::get<draupnir::utils::index_of_v<Trait,SettingTraits...>>(m_values);
+    }
+
+    /*! @brief Replaces value of the Trait stored within this snapshot.
+     *  @tparam Trait Must be one of the traits in the snapshot. */
+    template<SettingTraitConcept Trait>
+    void set(const typename Trait::Value& value) {
+        static_assert(contains<Trait>(),
+                "Specified Trait is not a member of SettingTraits... pack.");
+        std::get<draupnir::utils::index_of_v<Trait,SettingTraits...>>(m_values) = value;
+    }
+
+    /*! @brief Compares values of two snapshots. Available when all values are equality comparable. */
+    bool operator==(const SettingsSnapshotTemplate& other) const = default;
+
+private:
+    ValueTuple m_values;
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // SETTINGSSNAPSHOTTEMPLATE_H
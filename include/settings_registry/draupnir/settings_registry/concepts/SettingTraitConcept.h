@@ -27,6 +27,9 @@
 
 #include <QString>
 
+#include <string_view>
+#include <type_traits>
+
 namespace Draupnir::Settings
 {
 
@@ -54,6 +57,17 @@ concept HasKeyMethod = requires {
     { Candidate::key() } -> std::convertible_to<QString>;
 };
 
+/*! @headerfile draupnir/settings_registry/concepts/SettingTraitConcept.h
+ *  @ingroup SettingsRegistry
+ *  @brief This concept requires type Candidate to have public static constexpr method `std::string_view Candidate::keyView()`
+ *         which can be evaluated at compile time. */
+
+template<class Candidate>
+concept HasConstexprKey = requires {
+    { Candidate::keyView() } -> std::convertible_to<std::string_view>;
+    typename std::integral_constant<std::size_t, std::string_view{Candidate::keyView()}.size()>;
+};
+
 /*! @headerfile draupnir/settings_registry/concepts/SettingTraitConcept.h
  *  @ingroup SettingsRegistry
  *  @brief This concept requires type `Candidate` to have public static method `typename Candidate::Value Candidate::defaultValue()`*/
@@ -113,14 +127,15 @@ concept SettingTraitConcept =
 
 /*! @headerfile draupnir/settings_registry/concepts/SettingTraitConcept.h
  *  @ingroup SettingsRegistry
- *  @brief This concept is combination of three other concepts: @ref Draupnir::Settings::SettingTrait::HasValueType,
- *         @ref Draupnir::Settings::SettingTrait::HasKeyMethod, @ref Draupnir::Settings::SettingTrait::HasDefaultValueMethod.
- *         Every type to be used as SettingTrait - must fulfill these requirements. */
+ *  @brief This concept is combination of other concepts: @ref Draupnir::Settings::SettingTrait::HasValueType,
+ *         @ref Draupnir::Settings::SettingTrait::HasDefaultValueMethod and either
+ *         @ref Draupnir::Settings::SettingTrait::HasConstexprKey or @ref Draupnir::Settings::SettingTrait::HasKeyMethod.
+ *         Every type to be used as SettingTrait with the default serialization - must fulfill these requirements. */
 
 template<class Candidate>
 concept PrimitiveSettingTraitConcept =
     SettingTrait::HasValueType<Candidate> &&
-    SettingTrait::HasKeyMethod<Candidate> &&
+    (SettingTrait::HasConstexprKey<Candidate> || SettingTrait::HasKeyMethod<Candidate>) &&
     SettingTrait::HasDefaultValueMethod<Candidate>;
 
 }; // namespace Draupnir::Settings
@@ -25,8 +25,11 @@
 #ifndef SETTINGSBACKENDCONCEPT_H
 #define SETTINGSBACKENDCONCEPT_H
 
+#include <QByteArray>
 #include <QVariant>
 
+#include <optional>
+
 namespace Draupnir::Settings
 {
 
@@ -48,6 +51,30 @@ concept HasValueMethod = requires(Candidate& obj, QString key) {
     { obj.value(key) } -> std::same_as<QVariant>;
 };
 
+template<class Candidate>
+concept HasInt64Access = requires(Candidate& obj, QString key, qint64 value) {
+    { obj.getInt64(key) } -> std::same_as<std::optional<qint64>>;
+    { obj.setInt64(key,value) } -> std::same_as<void>;
+};
+
+template<class Candidate>
+concept HasDoubleAccess = requires(Candidate& obj, QString key, double value) {
+    { obj.getDouble(key) } -> std::same_as<std::optional<double>>;
+    { obj.setDouble(key,value) } -> std::same_as<void>;
+};
+
+template<class Candidate>
+concept HasStringAccess = requires(Candidate& obj, QString key, QString value) {
+    { obj.getString(key) } -> std::same_as<std::optional<QString>>;
+    { obj.setString(key,value) } -> std::same_as<void>;
+};
+
+template<class Candidate>
+concept HasBytesAccess = requires(Candidate& obj, QString key, QByteArray value) {
+    { obj.getBytes(key) } -> std::same_as<std::optional<QByteArray>>;
+    { obj.setBytes(key,value) } -> std::same_as<void>;
+};
+
 }; // namespace Draupnir::Settings::SettingsBackend
 
 template<class Candidate>
@@ -56,6 +83,24 @@ concept SettingsBackendConcept =
     SettingsBackend::HasValueMethod<Candidate> &&
     SettingsBackend::HasSetValueMethod<Candidate>;
 
+/*! @headerfile draupnir/settings_registry/concepts/SettingsBackendConcept.h
+ *  @ingroup SettingsRegistry
+ *  @brief This concept is satisfied by backends which, in addition to the `QVariant`-based interface, provide typed access
+ *         to the stored values: `getInt64` / `setInt64`, `getDouble` / `setDouble`, `getString` / `setString` and
+ *         `getBytes` / `setBytes`. Getters return `std::nullopt` when the key is missing or holds a value of other type.
+ *
+ *  @details @ref Draupnir::Settings::SettingTraitSerializer uses these methods for primitive values (integers, enums,
+ *           enum flags, floating point numbers, QString and QByteArray), so neither `QVariant` boxing nor string conversions
+ *           are performed. See also @ref Draupnir::Settings::TypedSettingsBackendInterface. */
+
+template<class Candidate>
+concept TypedSettingsBackendConcept =
+    SettingsBackendConcept<Candidate> &&
+    SettingsBackend::HasInt64Access<Candidate> &&
+    SettingsBackend::HasDoubleAccess<Candidate> &&
+    SettingsBackend::HasStringAccess<Candidate> &&
+    SettingsBackend::HasBytesAccess<Candidate>;
+
 }; // namespace Draupnir::Settings
 
 #endif // SETTINGSBACKENDCONCEPT_H
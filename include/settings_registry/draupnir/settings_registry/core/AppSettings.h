@@ -87,6 +87,13 @@ public:
     /*! @brief Returns true if preservation mode is enabled. */
     bool preserveConfig() const { return m_preserveConfig; }
 
+    /*! @brief Returns path to the file where settings are stored. */
+    QString fileName() const;
+
+    /*! @brief Writes unsaved changes to the permanent storage and reloads values changed in the meantime by other
+     *         processes. */
+    void sync();
+
     /*! @brief Checks if a value exists by key (optionally in a given section).
      * @param key - configuration key (optionally with section prefix).
      * @return True if the value exists.
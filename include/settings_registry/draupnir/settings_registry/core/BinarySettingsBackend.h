@@ -0,0 +1,163 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef BINARYSETTINGSBACKEND_H
+#define BINARYSETTINGSBACKEND_H
+
+#include <QFile>
+#include <QHash>
+#include <QString>
+
+#include <expected>
+
+#include "draupnir/settings_registry/core/TypedSettingsBackendInterface.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class BinarySettingsBackend draupnir/settings_registry/core/BinarySettingsBackend.h
+ *  @ingroup SettingsRegistry
+ *  @brief Settings backend storing values within a compact versioned binary file, which is memory-mapped while reading.
+ *
+ *  @details Loading (@ref load) maps the file read-only and validates its header; nothing is parsed. Each lookup computes the
+ *           hash of the key and performs a binary search within the index table sorted by hashes, so reading a setting costs
+ *           `O(log N)` without any allocations besides the returned value.
+ *
+ *           Changed values are kept in memory until @ref commit is called. Commit writes the whole file to a temporary file
+ *           in the same directory and renames it over the original one (see `QSaveFile`), so the file on disk is always
+ *           either old or new version. SettingsRegistryTemplate commits after each immediate write and after each
+ *           write-behind batch; destructor commits pending changes as well.
+ *
+ *           Values written through typed methods of @ref Draupnir::Settings::TypedSettingsBackendInterface are stored
+ *           natively. Other values are stored as `QVariant` serialized with `QDataStream`. Typed getters return
+ *           `std::nullopt` for values stored with other type.
+ *
+ *           File layout (all integers are little-endian):
+ *           - header: magic `"DRST"` (`quint32`), format version (`quint16`), reserved (`quint16`), amount of entries
+ *             (`quint32`), reserved (`quint32`);
+ *           - index: entries sorted by key hash. Each entry is `quint64` FNV-1a hash of the UTF-8 key, `quint32` key offset,
+ *             `quint32` key size, `quint32` value offset, `quint32` value size, `quint8` value type and 7 bytes of padding;
+ *           - data: UTF-8 keys and encoded values referred to by the index.
+ *
+ *           Usage:
+ *           @code
+ *           BinarySettingsBackend backend{QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation) + "/settings.bin"};
+ *           if (const auto loaded = backend.load(); !loaded)
+ *               qWarning() << loaded.error();
+ *           registry.setBackend(&backend);
+ *           @endcode
+ *
+ * @note This class is included only when DRAUPNIR_SETTINGS_USE_CUSTOM macro is defined. */
+
+class BinarySettingsBackend final : public TypedSettingsBackendInterface
+{
+    Q_DISABLE_COPY(BinarySettingsBackend);
+public:
+    /*! @brief Current version of the file format. */
+    static constexpr quint16 formatVersion = 1;
+
+    /*! @brief Constructor. File is not read until @ref load is called.
+     *  @param fileName Path to the settings file. */
+    explicit BinarySettingsBackend(const QString& fileName);
+
+    /*! @brief Destructor. Commits pending changes and unmaps the file. */
+    ~BinarySettingsBackend() final;
+
+    /*! @brief Returns path to the settings file. */
+    QString fileName() const final { return m_fileName; }
+
+    /*! @brief Maps the settings file. Missing file is not an error - backend starts empty.
+     *  @return Nothing on success or error description if the file can not be opened or has invalid format. In case of error
+     *          the backend stays empty. */
+    std::expected<void,QString> load();
+
+    /*! @brief Writes all values to the settings file, replacing it atomically, and maps the new file. Does nothing if there
+     *         are no pending changes.
+     *  @return Nothing on success or error description. In case of error pending changes are kept. */
+    std::expected<void,QString> commit() final;
+
+    /*! @brief Returns `true` if there are changes not yet written by @ref commit. */
+    bool hasPendingChanges() const { return !m_changes.isEmpty(); }
+
+    /*! @brief Returns amount of values stored. */
+    int count() const;
+
+    /*! @brief Maps the settings file again, keeping changes not yet written by @ref commit. Errors are reported by qWarning. */
+    void reload() final;
+
+///@name SettingsBackendInterface implementation
+///@{
+    bool contains(const QString& key) const final;
+    QVariant value(const QString& key, const QVariant& defaultValue = QVariant{}) final;
+    void setValue(const QString& key, const QVariant& value) final;
+///@}
+
+///@name TypedSettingsBackendInterface implementation
+///@{
+    std::optional<qint64> getInt64(const QString& key) final;
+    void setInt64(const QString& key, qint64 value) final;
+    std::optional<double> getDouble(const QString& key) final;
+    void setDouble(const QString& key, double value) final;
+    std::optional<QString> getString(const QString& key) final;
+    void setString(const QString& key, const QString& value) final;
+    std::optional<QByteArray> getBytes(const QString& key) final;
+    void setBytes(const QString& key, const QByteArray& value) final;
+///@}
+
+private:
+    /*! @brief Type of the stored value. */
+    enum ValueType : quint8 {
+        Int64   = 1,
+        Double  = 2,
+        String  = 3,
+        Bytes   = 4,
+        Variant = 5
+    };
+
+    /*! @brief Encoded value: type and raw bytes. Bytes point either into the mapped file or into `m_changes`. */
+    struct EncodedValue {
+        ValueType type;
+        const char* data;
+        int size;
+    };
+
+    QString m_fileName;
+    QFile m_file;
+    const uchar* p_mapped;
+    qint64 m_mappedSize;
+    quint32 m_entryCount;
+
+    /*! @brief Changed values not yet committed: value type and encoded bytes. */
+    QHash<QString,QPair<ValueType,QByteArray>> m_changes;
+
+    void _unmap();
+    std::optional<EncodedValue> _find(const QString& key) const;
+    std::optional<EncodedValue> _findMapped(const QString& key) const;
+    void _set(const QString& key, ValueType type, const QByteArray& data);
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // BINARYSETTINGSBACKEND_H
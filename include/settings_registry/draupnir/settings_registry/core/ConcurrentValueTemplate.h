@@ -0,0 +1,219 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef CONCURRENTVALUETEMPLATE_H
+#define CONCURRENTVALUETEMPLATE_H
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QtGlobal>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace Draupnir::Settings
+{
+
+/*! @enum ConcurrentValueKind
+ *  @ingroup SettingsRegistry
+ *  @brief Synchronization strategy used by @ref Draupnir::Settings::ConcurrentValueTemplate for a specific value type. */
+
+enum class ConcurrentValueKind {
+    Atomic,         /*!< @brief Value is stored within lock-free `std::atomic`. */
+    SequenceLock,   /*!< @brief Trivially-copyable value is stored within words protected by a sequence counter. */
+    Snapshot        /*!< @brief Value is stored within immutable heap snapshot replaced on every write. Pointer to the
+                         *          snapshot is copied under a mutex held only for the copy. */
+};
+
+/*! @headerfile draupnir/settings_registry/core/ConcurrentValueTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief This concept is satisfied by types which can be stored within lock-free `std::atomic`. */
+
+template<class Candidate>
+concept LockFreeAtomicValue =
+    std::is_trivially_copyable_v<Candidate> &&
+    std::is_copy_constructible_v<Candidate> &&
+    std::is_move_constructible_v<Candidate> &&
+    std::is_copy_assignable_v<Candidate> &&
+    std::is_move_assignable_v<Candidate> &&
+    std::atomic<Candidate>::is_always_lock_free;
+
+/*! @headerfile draupnir/settings_registry/core/ConcurrentValueTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief This concept is satisfied by trivially-copyable types which can be copied word by word under a sequence lock. */
+
+template<class Candidate>
+concept SequenceLockValue =
+    !LockFreeAtomicValue<Candidate> &&
+    std::is_trivially_copyable_v<Candidate> &&
+    std::is_default_constructible_v<Candidate>;
+
+/*! @class ConcurrentValueTemplate draupnir/settings_registry/core/ConcurrentValueTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief Single-writer / multiple-reader storage of a setting value which can be read from any thread.
+ *  @tparam Value Type of the stored value.
+ *
+ *  @details Storage strategy is selected at compile time:
+ *           - Small trivially-copyable values (`bool`, `int`, enums, `double`, `QSize`, ...) are kept within lock-free
+ *             `std::atomic` (@ref ConcurrentValueKind::Atomic);
+ *           - Larger trivially-copyable values are kept within an array of atomic words protected by a sequence counter.
+ *             Readers retry when a write happened while they were copying (@ref ConcurrentValueKind::SequenceLock);
+ *           - Other values (`QString`, `QStringList`, ...) are kept within immutable heap snapshot. Writer publishes a new
+ *             snapshot, readers keep the snapshot they have obtained alive for as long as they need it
+ *             (@ref ConcurrentValueKind::Snapshot).
+ *
+ *           Readers never wait for each other. Readers of the first two kinds are lock-free, readers of snapshots take a
+ *           mutex only to copy the `std::shared_ptr`, as `std::atomic<std::shared_ptr>` is not lock-free in libstdc++
+ *           and is missing in libc++. The value itself is never copied under the mutex.
+ *
+ * @note Only one thread may call @ref store at a time. */
+
+template<class Value>
+class ConcurrentValueTemplate
+{
+    Q_DISABLE_COPY(ConcurrentValueTemplate);
+public:
+    /*! @brief Strategy used for this Value type. */
+    static constexpr ConcurrentValueKind kind = ConcurrentValueKind::Snapshot;
+
+    /*! @brief Constructor. Publishes `initial` value. */
+    explicit ConcurrentValueTemplate(const Value& initial) :
+        m_snapshot{std::make_shared<const Value>(initial)}
+    {}
+
+    /*! @brief Returns copy of the currently published value. Can be called from any thread. */
+    Value load() const { return *snapshot(); }
+
+    /*! @brief Returns currently published snapshot. Snapshot remains valid and unchanged after following @ref store calls.
+     *         Can be called from any thread. */
+    std::shared_ptr<const Value> snapshot() const {
+        QMutexLocker locker{&m_mutex};
+        return m_snapshot;
+    }
+
+    /*! @brief Publishes new value. Value is copied and previous snapshot is released outside of the mutex. */
+    void store(const Value& value) {
+        std::shared_ptr<const Value> snapshot = std::make_shared<const Value>(value);
+        QMutexLocker locker{&m_mutex};
+        m_snapshot.swap(snapshot);
+    }
+
+private:
+    mutable QMutex m_mutex;
+    std::shared_ptr<const Value> m_snapshot;
+};
+
+/*! @brief Specialization of @ref ConcurrentValueTemplate for values stored within lock-free `std::atomic`. */
+
+template<LockFreeAtomicValue Value>
+class ConcurrentValueTemplate<Value>
+{
+    Q_DISABLE_COPY(ConcurrentValueTemplate);
+public:
+    static constexpr ConcurrentValueKind kind = ConcurrentValueKind::Atomic;
+
+    explicit ConcurrentValueTemplate(const Value& initial) :
+        m_value{initial}
+    {}
+
+    Value load() const { return m_value.load(std::memory_order_acquire); }
+
+    void store(const Value& value) { m_value.store(value, std::memory_order_release); }
+
+private:
+    std::atomic<Value> m_value;
+};
+
+/*! @brief Specialization of @ref ConcurrentValueTemplate for trivially-copyable values protected by a sequence lock. */
+
+template<SequenceLockValue Value>
+class ConcurrentValueTemplate<Value>
+{
+    Q_DISABLE_COPY(ConcurrentValueTemplate);
+    using Word = quint64;
+    static constexpr std::size_t WordCount = (sizeof(Value) + sizeof(Word) - 1) / sizeof(Word);
+    using Words = std::array<Word,WordCount>;
+
+public:
+    static constexpr ConcurrentValueKind kind = ConcurrentValueKind::SequenceLock;
+
+    explicit ConcurrentValueTemplate(const Value& initial) :
+        m_sequence{0}
+    {
+        _storeWords(_toWords(initial));
+    }
+
+    Value load() const {
+        Words words;
+        for (;;) {
+            const quint32 before = m_sequence.load(std::memory_order_acquire);
+            if (before & 1u)
+                continue;
+
+            for (std::size_t i = 0; i < WordCount; i++)
+                words[i] = m_words[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == before)
+                break;
+        }
+
+        Value result;
+        std::memcpy(static_cast<void*>(&result), words.data(), sizeof(Value));
+        return result;
+    }
+
+    void store(const Value& value) {
+        const Words words = _toWords(value);
+        const quint32 sequence = m_sequence.load(std::memory_order_relaxed);
+
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _storeWords(words);
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    std::atomic<quint32> m_sequence;
+    std::array<std::atomic<Word>,WordCount> m_words;
+
+    static Words _toWords(const Value& value) {
+        Words result{};
+        std::memcpy(result.data(), static_cast<const void*>(&value), sizeof(Value));
+        return result;
+    }
+
+    void _storeWords(const Words& words) {
+        for (std::size_t i = 0; i < WordCount; i++)
+            m_words[i].store(words[i], std::memory_order_relaxed);
+    }
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // CONCURRENTVALUETEMPLATE_H
@@ -0,0 +1,74 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef INMEMORYSETTINGSBACKEND_H
+#define INMEMORYSETTINGSBACKEND_H
+
+#include <QHash>
+
+#include "draupnir/settings_registry/core/SettingsBackendInterface.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class InMemorySettingsBackend draupnir/settings_registry/core/InMemorySettingsBackend.h
+ *  @ingroup SettingsRegistry
+ *  @brief Implementation of @ref Draupnir::Settings::SettingsBackendInterface keeping values within a hash table in memory.
+ *
+ *  @details Nothing is persisted. This backend is intended as a stand-in for tests, benchmarks and for applications which
+ *           need settings only for the lifetime of the process (e.g. in "portable" or "incognito" modes).
+ *
+ * @note This class is included only when DRAUPNIR_SETTINGS_USE_CUSTOM macro is defined. */
+
+class InMemorySettingsBackend final : public SettingsBackendInterface
+{
+public:
+    /*! @brief Constructor. Creates empty backend. */
+    InMemorySettingsBackend() = default;
+
+    /*! @brief Returns amount of stored values. */
+    int count() const { return m_values.count(); }
+
+    /*! @brief Removes all stored values. */
+    void clear() { m_values.clear(); }
+
+///@name SettingsBackendInterface implementation
+///@{
+    bool contains(const QString& key) const final { return m_values.contains(key); }
+
+    QVariant value(const QString& key, const QVariant& defaultValue = QVariant{}) final {
+        return m_values.value(key, defaultValue);
+    }
+
+    void setValue(const QString& key, const QVariant& value) final { m_values.insert(key, value); }
+///@}
+
+private:
+    QHash<QString,QVariant> m_values;
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // INMEMORYSETTINGSBACKEND_H
@@ -25,12 +25,16 @@
 #ifndef SETTINGSBACKENDINTERFACE_H
 #define SETTINGSBACKENDINTERFACE_H
 
+#include <expected>
+
 #include <QVariant>
 #include <QString>
 
 namespace Draupnir::Settings
 {
 
+class TypedSettingsBackendInterface;
+
 /*! @class SettingsBackendInterface draupnir/core/SettingsBackendInterface.h
  *  @ingroup SettingsRegistry
  *  @brief This is a base interface class for a custom backends which can be used by the SettingsRegistryTemplate.
@@ -59,6 +63,24 @@ public:
     /*! @brief Should set value within the settings storage associated with provided key. */
     virtual void setValue(const QString& key, const QVariant& value) = 0;
 ///@}
+
+    /*! @brief Returns this object as @ref Draupnir::Settings::TypedSettingsBackendInterface if the backend provides typed
+     *         access to the stored values, `nullptr` otherwise. Default implementation returns `nullptr`. */
+    virtual TypedSettingsBackendInterface* typedBackend() { return nullptr; }
+
+    /*! @brief Returns path to the file where settings are stored or empty string if the backend is not backed by a file.
+     *         Used by SettingsRegistryTemplate::setHotReloadEnabled. Default implementation returns empty string. */
+    virtual QString fileName() const { return QString{}; }
+
+    /*! @brief Should re-read the underlying storage, so values changed outside of this backend become visible. Changes made
+     *         through this backend and not yet persisted must be kept. Default implementation does nothing. */
+    virtual void reload() {}
+
+    /*! @brief Should persist values written through this backend. Called by SettingsRegistryTemplate after each batch of
+     *         writes, so backends buffering changes in memory do not lose them until destruction. Default implementation
+     *         does nothing.
+     *  @return Nothing on success or error description. */
+    virtual std::expected<void,QString> commit() { return {}; }
 };
 
 }; // namespace Draupnir::Settings
@@ -0,0 +1,60 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SETTINGSWRITEBEHINDINTERFACE_H
+#define SETTINGSWRITEBEHINDINTERFACE_H
+
+#include <cstddef>
+
+namespace Draupnir::Settings
+{
+
+/*! @class SettingsWriteBehindInterface draupnir/settings_registry/core/SettingsWriteBehindInterface.h
+ *  @ingroup SettingsRegistry
+ *  @brief Hook through which @ref Draupnir::Settings::SettingsBundleTemplate objects report changed values to the
+ *         @ref Draupnir::Settings::SettingsRegistryTemplate they were created from.
+ *
+ *  @details The registry is told about every change of an in-memory value, whether it was made on the registry itself or
+ *           on one of its bundles. It reacts by publishing the value to derived registries (see
+ *           SettingsRegistryTemplate::settingUpdated), scheduling change notifications for its subscribers and, when
+ *           write-behind mode is enabled, marking the setting as dirty so it is written to the backend later in one batch.
+ *           Bundles do not know the full list of registry traits, so they refer to settings by their index within the
+ *           registry. */
+
+class SettingsWriteBehindInterface
+{
+public:
+    /*! @brief Virtual trivial destructor. */
+    virtual ~SettingsWriteBehindInterface() = default;
+
+    /*! @brief Called after in-memory value of the setting was changed.
+     *  @param registryIndex Index of the setting trait within the registry.
+     *  @return `true` if writing to the backend was deferred; `false` if the caller must write the value immediately. */
+    virtual bool settingChanged(std::size_t registryIndex) = 0;
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // SETTINGSWRITEBEHINDINTERFACE_H
@@ -0,0 +1,89 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef TYPEDSETTINGSBACKENDINTERFACE_H
+#define TYPEDSETTINGSBACKENDINTERFACE_H
+
+#include <QByteArray>
+
+#include <optional>
+
+#include "draupnir/settings_registry/core/SettingsBackendInterface.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class TypedSettingsBackendInterface draupnir/settings_registry/core/TypedSettingsBackendInterface.h
+ *  @ingroup SettingsRegistry
+ *  @brief Extension of the @ref Draupnir::Settings::SettingsBackendInterface for backends storing native values.
+ *
+ *  @details Backends inheriting this class are detected at runtime by the @ref Draupnir::Settings::SettingTraitSerializer
+ *           (through @ref SettingsBackendInterface::typedBackend). Settings with primitive values (integers, enums, enum
+ *           flags, floating point numbers, QString and QByteArray) are then read and written through the typed methods
+ *           below, bypassing `QVariant` boxing and string conversions. Other settings still use the `QVariant`-based
+ *           methods of @ref Draupnir::Settings::SettingsBackendInterface.
+ *
+ *           Typed getters must return `std::nullopt` when there is no value for the key or the stored value has other type. */
+
+class TypedSettingsBackendInterface : public SettingsBackendInterface
+{
+public:
+    /*! @brief Virtual trivial destructor. */
+    ~TypedSettingsBackendInterface() override = default;
+
+    /*! @brief Returns this object. */
+    TypedSettingsBackendInterface* typedBackend() final { return this; }
+
+///@name Group of virtual methods to be implemented while subclassing the TypedSettingsBackendInterface
+///@{
+    /*! @brief Should return integer value associated with provided key. */
+    virtual std::optional<qint64> getInt64(const QString& key) = 0;
+
+    /*! @brief Should set integer value associated with provided key. */
+    virtual void setInt64(const QString& key, qint64 value) = 0;
+
+    /*! @brief Should return floating point value associated with provided key. */
+    virtual std::optional<double> getDouble(const QString& key) = 0;
+
+    /*! @brief Should set floating point value associated with provided key. */
+    virtual void setDouble(const QString& key, double value) = 0;
+
+    /*! @brief Should return string value associated with provided key. */
+    virtual std::optional<QString> getString(const QString& key) = 0;
+
+    /*! @brief Should set string value associated with provided key. */
+    virtual void setString(const QString& key, const QString& value) = 0;
+
+    /*! @brief Should return byte array associated with provided key. */
+    virtual std::optional<QByteArray> getBytes(const QString& key) = 0;
+
+    /*! @brief Should set byte array associated with provided key. */
+    virtual void setBytes(const QString& key, const QByteArray& value) = 0;
+///@}
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // TYPEDSETTINGSBACKENDINTERFACE_H
@@ -28,6 +28,10 @@
 #include <QDir>
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings
 {
 
@@ -49,7 +53,10 @@ struct LastUsedDirectorySetting
     using Value = QString;
 
     /*! @brief Return the persistent storage key ("files/last_used_directory"). */
-    static QString key() { return "files/last_used_directory"; }
+    static constexpr std::string_view keyView() { return "files/last_used_directory"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<LastUsedDirectorySetting>::qString(); }
 
     /*! @brief Return the default value - home directory of the user. */
     static QString defaultValue() { return QDir::homePath(); }
@@ -27,6 +27,10 @@
 
 #include <QStringList>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings
 {
 
@@ -43,7 +47,10 @@ struct RecentFileListSetting
     using Value = QStringList;
 
     /*! @brief Return the persistent storage key ("files/recent_files"). */
-    static QString key() { return "files/recent_files"; }
+    static constexpr std::string_view keyView() { return "files/recent_files"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<RecentFileListSetting>::qString(); }
 
     /*! @brief Return the default value - empty QStringList. */
     static QStringList defaultValue() { return QStringList{}; }
@@ -28,6 +28,10 @@
 #include <QSize>
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings
 {
 
@@ -41,7 +45,8 @@ namespace Draupnir::Settings
  *  @details This struct provides a concise way to declare new setting traits. A setting trait defined via this template
  *           supplies:
  *           - using Value — the underlying C++ value type (e.g. bool, int, QString);
- *           - static QString key() — the storage key as a QString, built from @p settingsKey;
+ *           - static constexpr std::string_view keyView() — the storage key, built from @p settingsKey;
+ *           - static QString key() — the same key as a QString;
  *           - static Value defaultValue() — the default value.
  *
  *           Example:
@@ -63,8 +68,11 @@ struct SettingTraitTemplate
     /*! @brief Underlying value type. */
     using Value = ValueClass;
 
-    /*! @brief Return the persistent key as a QString. */
-    static QString key() { return QString{settingsKey}; }
+    /*! @brief Return the persistent key. */
+    static constexpr std::string_view keyView() { return settingsKey; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<SettingTraitTemplate>::qString(); }
 
     /*! @brief Return the compile-time default value. */
     static Value defaultValue() { return value; }
@@ -28,6 +28,10 @@
 #include <QSize>
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings
 {
 
@@ -41,7 +45,8 @@ namespace Draupnir::Settings
  *  @details This struct provides a concise way to declare new QSize setting traits. A setting trait defined via this template
  *           supplies:
  *           - using QSize — the underlying C++ value type;
- *           - static QString key() — the storage key as a QString, built from @p settingsKey;
+ *           - static constexpr std::string_view keyView() — the storage key, built from @p settingsKey;
+ *           - static QString key() — the same key as a QString;
  *           - static QSize defaultValue() — the default value constructed from provided width and height.
  *
  * @todo Question: Is this class required? */
@@ -52,8 +57,11 @@ struct SizeSettingTraitTemplate
     /*! @brief Underlying value type. */
     using Value = QSize;
 
-    /*! @brief Return the persistent key as a QString. */
-    static QString key() { return QString{settingsKey}; }
+    /*! @brief Return the persistent key. */
+    static constexpr std::string_view keyView() { return settingsKey; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<SizeSettingTraitTemplate>::qString(); }
 
     /*! @brief Return the default value. */
     static QSize defaultValue() { return QSize{defaultWidth,defaultHeight}; }
@@ -0,0 +1,85 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SETTINGTRAITKEY_H
+#define SETTINGTRAITKEY_H
+
+#include <QString>
+
+#include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
+#include "draupnir/utils/static_perfect_hash.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class SettingTraitKey draupnir/settings_registry/utils/SettingTraitKey.h
+ *  @ingroup SettingsRegistry
+ *  @brief Uniform access to the persistent key of a setting trait.
+ *  @tparam Trait Setting trait satisfying @ref PrimitiveSettingTraitConcept.
+ *
+ *  @details Setting traits may declare their key either as `static QString key()` or as
+ *           `static constexpr std::string_view keyView()`. This generic version covers the first case: @ref qString simply
+ *           calls `Trait::key()` and no compile-time information is available.
+ *
+ *           When the trait declares `keyView()` the specialization below is used. It provides the key as a compile-time
+ *           `std::string_view` along with its precomputed @ref draupnir::utils::fnv1a_64 hash, and @ref qString returns a
+ *           reference to the QString which is built only once. So backends receive the key without any allocation and
+ *           generic tooling can dispatch keys to traits by @ref Draupnir::Settings::SettingsRegistryTemplate::indexOfKey. */
+
+template<PrimitiveSettingTraitConcept Trait>
+class SettingTraitKey
+{
+public:
+    /*! @brief `true` if the key is available at compile time. */
+    static constexpr bool isConstexpr = false;
+
+    /*! @brief Returns the key as QString. */
+    static QString qString() { return Trait::key(); }
+};
+
+template<PrimitiveSettingTraitConcept Trait>
+    requires(SettingTrait::HasConstexprKey<Trait>)
+class SettingTraitKey<Trait>
+{
+public:
+    /*! @brief `true` if the key is available at compile time. */
+    static constexpr bool isConstexpr = true;
+
+    /*! @brief The key. */
+    static constexpr std::string_view view = Trait::keyView();
+
+    /*! @brief Precomputed hash of the key. */
+    static constexpr std::uint64_t hash = draupnir::utils::fnv1a_64(view);
+
+    /*! @brief Returns the key as QString. QString object is created on the first call and shared afterwards. */
+    static const QString& qString() {
+        static const QString key{QString::fromUtf8(view.data(), static_cast<int>(view.size()))};
+        return key;
+    }
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // SETTINGTRAITKEY_H
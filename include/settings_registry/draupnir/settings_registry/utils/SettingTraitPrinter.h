@@ -28,6 +28,7 @@
 #include <QTextStream>
 
 #include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
 #include "draupnir/settings_registry/utils/ValueSerializerTemplate.h"
 
 namespace Draupnir::Settings
@@ -59,7 +60,7 @@ class SettingTraitPrinter<Trait>
 public:
     template<class Output>
     inline static void print(Output&& output, const Trait::Value& value) {
-        output << Trait::key()
+        output << SettingTraitKey<Trait>::qString()
                << " = "
                << value
                << Qt::endl;
@@ -73,7 +74,7 @@ class SettingTraitPrinter<Trait>
 public:
     template<class Output>
     inline static void print(Output&& output, const Trait::Value& value) {
-        output << Trait::key()
+        output << SettingTraitKey<Trait>::qString()
                << " = "
                << ValueSerializerTemplate<typename Trait::Value>::toQVariant(value)
                << Qt::endl;
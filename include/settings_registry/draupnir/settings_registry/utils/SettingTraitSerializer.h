@@ -27,6 +27,9 @@
 
 #include "draupnir/settings_registry/concepts/SettingTraitConcept.h"
 #include "draupnir/settings_registry/concepts/SettingsBackendConcept.h"
+#include "draupnir/settings_registry/core/TypedSettingsBackendInterface.h"
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+#include "draupnir/settings_registry/utils/TypedValueSerializerTemplate.h"
 #include "draupnir/settings_registry/utils/ValueSerializerTemplate.h"
 
 namespace Draupnir::Settings
@@ -45,12 +48,21 @@ namespace Draupnir::Settings
  *           A default implementation is provided only when `SettingTrait` satisfies @ref PrimitiveSettingTraitConcept, i.e.
  *           it defines:
  *           - `using Value`
- *           - `static QString key()`
+ *           - `static constexpr std::string_view keyView()` or `static QString key()`
  *           - `static Value defaultValue()`
  *
  *           The default implementation:
- *           - `get()` reads value from backend by `SettingTrait::key()`. If missing or invalid, returns `defaultValue()`.
- *           - `set()` writes value to backend under `SettingTrait::key()`.
+ *           - `get()` reads value from backend by the trait key. If missing or invalid, returns `defaultValue()`.
+ *           - `set()` writes value to backend under the trait key.
+ *
+ *           Key is obtained through @ref SettingTraitKey, so traits with `keyView()` do not allocate a new QString on every
+ *           call.
+ *
+ *           When the backend provides typed access to values (either statically - @ref TypedSettingsBackendConcept, or at
+ *           runtime - `typedBackend()` returns non-null pointer) and `Value` is supported by the
+ *           @ref TypedValueSerializerTemplate, values are read and written through the typed methods without `QVariant`.
+ *           If the typed getter finds no value (e.g. it was stored through `setValue()` or as another native type),
+ *           `get()` falls back to the `QVariant` path, so previously stored values are not lost.
  *
  *           ## Customization
  *           For complex types (e.g. multi-key settings, custom validation, non-QVariant-storable values), provide a full
@@ -76,10 +88,24 @@ public:
         Q_ASSERT_X(settings, "SettingTraitSerializer<Backend,SettingTrait>::get",
                    "Provided settings pointer is nullptr.");
 
-        if (!settings->contains(SettingTrait::key()))
+        const auto& key = SettingTraitKey<SettingTrait>::qString();
+        if constexpr (TypedValueSerializerTemplate<Value>::enabled) {
+            if constexpr (TypedSettingsBackendConcept<Backend>) {
+                if (const std::optional<Value> maybeValue = TypedValueSerializerTemplate<Value>::get(settings, key))
+                    return maybeValue.value();
+            } else if constexpr (requires { settings->typedBackend(); }) {
+                if (auto typedBackend = settings->typedBackend()) {
+                    if (const std::optional<Value> maybeValue = TypedValueSerializerTemplate<Value>::get(typedBackend, key))
+                        return maybeValue.value();
+                }
+            }
+        }
+
+        // Values stored through setValue() or under another native type are not returned by the typed getters.
+        if (!settings->contains(key))
             return SettingTrait::defaultValue();
 
-        const auto maybeValue = ValueSerializerTemplate<Value>::fromQVariant(settings->value(SettingTrait::key()));
+        const auto maybeValue = ValueSerializerTemplate<Value>::fromQVariant(settings->value(key));
         return (maybeValue) ? maybeValue.value() : SettingTrait::defaultValue();
     }
 
@@ -90,7 +116,20 @@ public:
         Q_ASSERT_X(settings, "SettingTraitSerializer<Backend,SettingTrait>::set",
                    "Provided settings pointer is nullptr.");
 
-        settings->setValue(SettingTrait::key(), ValueSerializerTemplate<Value>::toQVariant(value));
+        const auto& key = SettingTraitKey<SettingTrait>::qString();
+        if constexpr (TypedValueSerializerTemplate<Value>::enabled) {
+            if constexpr (TypedSettingsBackendConcept<Backend>) {
+                TypedValueSerializerTemplate<Value>::set(settings, key, value);
+                return;
+            } else if constexpr (requires { settings->typedBackend(); }) {
+                if (auto typedBackend = settings->typedBackend()) {
+                    TypedValueSerializerTemplate<Value>::set(typedBackend, key, value);
+                    return;
+                }
+            }
+        }
+
+        settings->setValue(key, ValueSerializerTemplate<Value>::toQVariant(value));
     }
 };
 
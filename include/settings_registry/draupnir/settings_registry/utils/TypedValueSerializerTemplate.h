@@ -0,0 +1,147 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef TYPEDVALUESERIALIZERTEMPLATE_H
+#define TYPEDVALUESERIALIZERTEMPLATE_H
+
+#include <QByteArray>
+#include <QString>
+
+#include <optional>
+#include <type_traits>
+
+#include "draupnir/settings_registry/utils/ValueSerializerTemplate.h"
+#include "draupnir/utils/flags.h"
+
+namespace Draupnir::Settings
+{
+
+/*! @class TypedValueSerializerTemplate draupnir/settings_registry/utils/TypedValueSerializerTemplate.h
+ *  @ingroup SettingsRegistry
+ *  @brief Static template class used within the @ref Draupnir::Settings::SettingTraitSerializer for reading / writing values
+ *         through the typed methods of backends satisfying @ref Draupnir::Settings::TypedSettingsBackendConcept.
+ *  @tparam Value Value type.
+ *
+ *  @details Generic version has `enabled` equal to `false`, meaning that values of this type are always serialized through
+ *           `QVariant` by @ref Draupnir::Settings::ValueSerializerTemplate. Specializations are provided for:
+ *           - integers, `bool` and enums (stored as `qint64`);
+ *           - enum flags without custom config serialization (stored as `qint64` mask);
+ *           - floating point numbers (stored as `double`);
+ *           - `QString` and `QByteArray`. */
+
+template<class Value>
+class TypedValueSerializerTemplate
+{
+public:
+    static constexpr bool enabled = false;
+};
+
+template<class Value>
+    requires(std::is_integral_v<Value> || std::is_enum_v<Value>)
+class TypedValueSerializerTemplate<Value>
+{
+public:
+    static constexpr bool enabled = true;
+
+    template<class Backend>
+    static std::optional<Value> get(Backend* backend, const QString& key) {
+        const std::optional<qint64> value = backend->getInt64(key);
+        return value ? std::optional<Value>{static_cast<Value>(*value)} : std::nullopt;
+    }
+
+    template<class Backend>
+    static void set(Backend* backend, const QString& key, const Value& value) {
+        backend->setInt64(key, static_cast<qint64>(value));
+    }
+};
+
+template<draupnir::utils::enum_flags_like_concept EnumFlags>
+    requires(!HasCustomEnumFlagsConfigSerialization<EnumFlags>)
+class TypedValueSerializerTemplate<EnumFlags>
+{
+    using Integer = std::underlying_type_t<typename EnumFlags::enum_type>;
+
+public:
+    static constexpr bool enabled = true;
+
+    template<class Backend>
+    static std::optional<EnumFlags> get(Backend* backend, const QString& key) {
+        const std::optional<qint64> value = backend->getInt64(key);
+        return value ? std::optional<EnumFlags>{EnumFlags{static_cast<Integer>(*value)}} : std::nullopt;
+    }
+
+    template<class Backend>
+    static void set(Backend* backend, const QString& key, const EnumFlags& value) {
+        backend->setInt64(key, static_cast<qint64>(value.value()));
+    }
+};
+
+template<std::floating_point Value>
+class TypedValueSerializerTemplate<Value>
+{
+public:
+    static constexpr bool enabled = true;
+
+    template<class Backend>
+    static std::optional<Value> get(Backend* backend, const QString& key) {
+        const std::optional<double> value = backend->getDouble(key);
+        return value ? std::optional<Value>{static_cast<Value>(*value)} : std::nullopt;
+    }
+
+    template<class Backend>
+    static void set(Backend* backend, const QString& key, const Value& value) {
+        backend->setDouble(key, static_cast<double>(value));
+    }
+};
+
+template<>
+class TypedValueSerializerTemplate<QString>
+{
+public:
+    static constexpr bool enabled = true;
+
+    template<class Backend>
+    static std::optional<QString> get(Backend* backend, const QString& key) { return backend->getString(key); }
+
+    template<class Backend>
+    static void set(Backend* backend, const QString& key, const QString& value) { backend->setString(key, value); }
+};
+
+template<>
+class TypedValueSerializerTemplate<QByteArray>
+{
+public:
+    static constexpr bool enabled = true;
+
+    template<class Backend>
+    static std::optional<QByteArray> get(Backend* backend, const QString& key) { return backend->getBytes(key); }
+
+    template<class Backend>
+    static void set(Backend* backend, const QString& key, const QByteArray& value) { backend->setBytes(key, value); }
+};
+
+}; // namespace Draupnir::Settings
+
+#endif // TYPEDVALUESERIALIZERTEMPLATE_H
@@ -139,7 +139,7 @@ public:
         bool ok = false;
         const auto maybeValue = _Helper<std::underlying_type_t<Enum>>::fromString(value.toString(),&ok,2);
         return (ok) ?
-            std::optional<EnumFlags>{EnumFlags{value}} :
+            std::optional<EnumFlags>{EnumFlags{maybeValue}} :
             std::nullopt;
     }
 
@@ -27,6 +27,10 @@
 
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings
 {
 
@@ -37,7 +41,8 @@ namespace Draupnir::Settings
  *  @details This trait defines a setting that stores and retrieves the active widget index as int.
  *           Provides:
  *           - using Value = int (the stored C++ type);
- *           - static QString key() — returns the persistent key string ("central_widget/active_widget_index");
+ *           - static constexpr std::string_view keyView() — returns the persistent key string ("central_widget/active_widget_index");
+ *           - static QString key() — the same key as a QString;
  *           - static int defaultValue() — returns the default index = 0.
  *
  * @todo Allow changing of the defaultValue behaviour using preprocessor and write test for this feature. */
@@ -48,7 +53,10 @@ struct CentralWidgetIndexSetting
     using Value = int;
 
     /*! @brief Return the persistent storage key ("central_widget/active_widget_index"). */
-    static QString key() { return "central_widget/active_widget_index"; }
+    static constexpr std::string_view keyView() { return "central_widget/active_widget_index"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<CentralWidgetIndexSetting>::qString(); }
 
     /*! @brief Return the default value - 0. */
     static int defaultValue() { return 0; }
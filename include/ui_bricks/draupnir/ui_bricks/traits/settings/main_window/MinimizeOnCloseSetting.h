@@ -27,6 +27,10 @@
 
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings::MainWindow
 {
 
@@ -36,7 +40,8 @@ namespace Draupnir::Settings::MainWindow
  *
  *  @details This struct provides MinimizeOnCloseSetting trait with:
  *           - using Value = bool;
- *           - static QString key();
+ *           - static constexpr std::string_view keyView();
+ *           - static QString key() — the same key as a QString;
  *           - static bool defaultValue();
  *
  * @todo Allow changing of the defaultValue behaviour using preprocessor and write test for this feature. */
@@ -47,7 +52,10 @@ struct MinimizeOnCloseSetting
     using Value = bool;
 
     /*! @brief Return the persistent storage key ("main_window/minimize_on_close"). */
-    static QString key() { return "main_window/minimize_on_close"; }
+    static constexpr std::string_view keyView() { return "main_window/minimize_on_close"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<MinimizeOnCloseSetting>::qString(); }
 
     /*! @brief Return the default value - home directory of the user. */
     static bool defaultValue() { return false; }
@@ -27,6 +27,10 @@
 
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings::MainWindow
 {
 
@@ -36,7 +40,8 @@ namespace Draupnir::Settings::MainWindow
  *
  *  @details This struct provides StartHiddenSetting trait with:
  *           - using Value = bool;
- *           - static QString key();
+ *           - static constexpr std::string_view keyView();
+ *           - static QString key() — the same key as a QString;
  *           - static bool defaultValue();
  *
  * @todo Allow changing of the defaultValue behaviour using preprocessor and write test for this feature. */
@@ -47,7 +52,10 @@ struct StartHiddenSetting
     using Value = bool;
 
     /*! @brief Return the persistent storage key ("main_window/start_hidden"). */
-    static QString key() { return "main_window/start_hidden"; }
+    static constexpr std::string_view keyView() { return "main_window/start_hidden"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<StartHiddenSetting>::qString(); }
 
     /*! @brief Return the default value - false. */
     static bool defaultValue() { return false; }
@@ -28,6 +28,10 @@
 #include <QSize>
 #include <QString>
 
+#include <string_view>
+
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
+
 namespace Draupnir::Settings::MainWindow
 {
 
@@ -40,7 +44,8 @@ namespace Draupnir::Settings::MainWindow
  *
  *           Provides:
  *           - using Value = QSize (the stored C++ type);
- *           - static QString key() — returns the persistent key string ("main_window/window_size");
+ *           - static constexpr std::string_view keyView() — returns the persistent key string ("main_window/window_size");
+ *           - static QString key() — the same key as a QString;
  *           - static Value defaultValue() — returns the default QSize (empty size).
  *
  * @todo Allow changing of the defaultValue behaviour using preprocessor and write test for this feature. */
@@ -51,7 +56,10 @@ struct WindowSizeSetting
     using Value = QSize;
 
     /*! @brief Return the persistent storage key ("main_window/window_size"). */
-    static QString key() { return "main_window/window_size"; }
+    static constexpr std::string_view keyView() { return "main_window/window_size"; }
+
+    /*! @brief Return the persistent key as a QString. Kept for code calling `key()` directly. */
+    static QString key() { return SettingTraitKey<WindowSizeSetting>::qString(); }
 
     /*! @brief Return the default value (empty QSize). */
     static QSize defaultValue() { return QSize{}; }
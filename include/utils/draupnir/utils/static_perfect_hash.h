@@ -0,0 +1,209 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef STATIC_PERFECT_HASH_H
+#define STATIC_PERFECT_HASH_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+namespace draupnir::utils
+{
+
+/*! @brief Computes 64-bit FNV-1a hash of the provided string. Can be evaluated at compile time.
+ *  @param string String to hash.
+ *  @return Hash value. */
+
+constexpr std::uint64_t fnv1a_64(std::string_view string) noexcept
+{
+    std::uint64_t result = 0xcbf29ce484222325ull;
+    for (const char character : string) {
+        result ^= static_cast<unsigned char>(character);
+        result *= 0x100000001b3ull;
+    }
+    return result;
+}
+
+/*! @class static_perfect_hash draupnir/utils/static_perfect_hash.h
+ *  @ingroup Utils
+ *  @brief Compile-time perfect hash table mapping a fixed set of `N` distinct strings to their indices `0 ... N-1`.
+ *  @tparam N Amount of keys.
+ *
+ *  @details Table is built by the "hash and displace" scheme: keys are distributed into buckets by their @ref fnv1a_64 hash,
+ *           then for every bucket (largest first) a displacement is searched for, which places all keys of the bucket into
+ *           free slots. Lookup therefore costs one hash computation, two array accesses and a single string comparison and
+ *           performs no allocations.
+ *
+ *           Table is intended to be built within a `constexpr` context:
+ *           @code
+ *           static constexpr draupnir::utils::static_perfect_hash<3> table{{"one", "two", "three"}};
+ *           static_assert(table.find("two") == 1);
+ *           @endcode
+ *
+ *           Keys must be distinct: duplicated keys would always collide. Construction throws `std::invalid_argument` for
+ *           duplicated keys and `std::length_error` if no displacement up to @ref max_displacement fits a bucket, so
+ *           within a `constexpr` context both cases are reported as compile errors instead of endless evaluation.
+ *
+ * @note Strings referred to by the keys must outlive the table (e.g. string literals). */
+
+template<std::size_t N>
+class static_perfect_hash
+{
+public:
+    /*! @brief Amount of buckets. Power of two which is not less than `N`. */
+    static constexpr std::size_t bucket_count = std::bit_ceil(N == 0 ? std::size_t{1} : N);
+
+    /*! @brief Amount of slots. Table is kept at most half full. */
+    static constexpr std::size_t slot_count = bucket_count * 2;
+
+    /*! @brief Maximal displacement tried for a single bucket. */
+    static constexpr std::uint32_t max_displacement = 1u << 16;
+
+    /*! @brief Returns `true` if @p keys contain the same string more than once. */
+    static constexpr bool has_duplicates(const std::array<std::string_view,N>& keys) {
+        std::array<std::string_view,N> sorted{keys};
+        std::sort(sorted.begin(), sorted.end());
+        return std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end();
+    }
+
+    /*! @brief Builds the table for the provided keys. */
+    constexpr explicit static_perfect_hash(const std::array<std::string_view,N>& keys) :
+        m_keys{keys}
+    {
+        if (has_duplicates(keys))
+            throw std::invalid_argument{"static_perfect_hash: keys must be distinct."};
+
+        m_slots.fill(empty_slot);
+        m_displacements.fill(0);
+
+        // Group key indices by bucket (counting sort), so each bucket is a contiguous range within bucketMembers.
+        std::array<std::uint64_t,N> hashes{};
+        std::array<std::size_t,bucket_count + 1> bucketStart{};
+        for (std::size_t i = 0; i < N; i++) {
+            hashes[i] = fnv1a_64(keys[i]);
+            bucketStart[_bucket(hashes[i]) + 1]++;
+        }
+        for (std::size_t i = 0; i < bucket_count; i++)
+            bucketStart[i + 1] += bucketStart[i];
+
+        std::array<std::size_t,N> bucketMembers{};
+        std::array<std::size_t,bucket_count> bucketFill{};
+        for (std::size_t i = 0; i < N; i++) {
+            const std::size_t bucket = _bucket(hashes[i]);
+            bucketMembers[bucketStart[bucket] + bucketFill[bucket]++] = i;
+        }
+
+        std::array<std::size_t,bucket_count> bucketOrder{};
+        for (std::size_t i = 0; i < bucket_count; i++)
+            bucketOrder[i] = i;
+        std::sort(bucketOrder.begin(), bucketOrder.end(), [&bucketFill](std::size_t left, std::size_t right) {
+            return bucketFill[left] > bucketFill[right];
+        });
+
+        std::array<std::size_t,N> placed{};
+        for (const std::size_t bucket : bucketOrder) {
+            const std::size_t first = bucketStart[bucket];
+            const std::size_t last = bucketStart[bucket + 1];
+            if (first == last)
+                break;
+
+            bool bucketPlaced = false;
+            for (std::uint32_t displacement = 0; displacement <= max_displacement; displacement++) {
+                std::size_t placedCount = 0;
+                for (std::size_t member = first; member < last; member++) {
+                    const std::size_t index = bucketMembers[member];
+                    const std::size_t slot = _slot(hashes[index], displacement);
+                    if (m_slots[slot] != empty_slot)
+                        break;
+                    m_slots[slot] = index;
+                    placed[placedCount++] = slot;
+                }
+
+                if (placedCount == last - first) {
+                    m_displacements[bucket] = displacement;
+                    bucketPlaced = true;
+                    break;
+                }
+
+                for (std::size_t i = 0; i < placedCount; i++)
+                    m_slots[placed[i]] = empty_slot;
+            }
+
+            if (!bucketPlaced)
+                throw std::length_error{"static_perfect_hash: no displacement fits a bucket."};
+        }
+    }
+
+    /*! @brief Returns index of the provided key or `std::nullopt` if the key is not within this table. */
+    constexpr std::optional<std::size_t> find(std::string_view key) const noexcept {
+        if constexpr (N == 0) {
+            return std::nullopt;
+        } else {
+            const std::uint64_t hash = fnv1a_64(key);
+            const std::size_t index = m_slots[_slot(hash, m_displacements[_bucket(hash)])];
+            if (index == empty_slot || m_keys[index] != key)
+                return std::nullopt;
+            return index;
+        }
+    }
+
+    /*! @brief Returns `true` if the provided key is within this table. */
+    constexpr bool contains(std::string_view key) const noexcept { return find(key).has_value(); }
+
+    /*! @brief Returns key with the provided index. */
+    constexpr std::string_view key(std::size_t index) const noexcept { return m_keys[index]; }
+
+    /*! @brief Returns amount of keys. */
+    static constexpr std::size_t size() noexcept { return N; }
+
+private:
+    static constexpr std::size_t empty_slot = N;
+
+    std::array<std::string_view,N> m_keys;
+    std::array<std::size_t,slot_count> m_slots{};
+    std::array<std::uint32_t,bucket_count> m_displacements{};
+
+    static constexpr std::size_t _bucket(std::uint64_t hash) noexcept {
+        return static_cast<std::size_t>(hash) & (bucket_count - 1);
+    }
+
+    static constexpr std::size_t _slot(std::uint64_t hash, std::uint32_t displacement) noexcept {
+        // splitmix64 finalizer, so slots do not depend on the low bits used for bucket selection only.
+        std::uint64_t mixed = hash ^ (static_cast<std::uint64_t>(displacement) * 0x9e3779b97f4a7c15ull);
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ull;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebull;
+        mixed ^= mixed >> 31;
+        return static_cast<std::size_t>(mixed) & (slot_count - 1);
+    }
+};
+
+}; // namespace draupnir::utils
+
+#endif // STATIC_PERFECT_HASH_H
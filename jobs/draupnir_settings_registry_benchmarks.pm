@@ -0,0 +1,5 @@
+{
+    runtime_tests => [
+        File::Spec->catdir("settings_registry","benchmark")
+    ]
+}
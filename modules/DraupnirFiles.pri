@@ -13,13 +13,27 @@
     HEADERS += \
         $$PWD/../include/files/draupnir/files/ScopedFileTemplate.h \
         $$PWD/../include/files/draupnir/files/concepts/FileConcept.h \
+        $$PWD/../include/files/draupnir/files/core/AtomicFileWriter.h \
+        $$PWD/../include/files/draupnir/files/core/ContentHasher.h \
+        $$PWD/../include/files/draupnir/files/core/FileWatcherService.h \
+        $$PWD/../include/files/draupnir/files/core/JsonStreamReader.h \
+        $$PWD/../include/files/draupnir/files/core/JsonStreamWriter.h \
+        $$PWD/../include/files/draupnir/files/core/ParallelFileReader.h \
         $$PWD/../include/files/draupnir/files/file_types/AbstractFile.h \
         $$PWD/../include/files/draupnir/files/file_types/AbstractJsonFile.h \
+        $$PWD/../include/files/draupnir/files/file_types/AbstractStreamingJsonFile.h \
         $$PWD/../include/files/draupnir/files/file_types/AbstractTextFile.h \
         $$PWD/../include/files/draupnir/files/file_types/AbstractXmlFile.h \
         $$PWD/../include/files/draupnir/files/managers/AbstractFileManager.h \
+        $$PWD/../include/files/draupnir/files/managers/MultiFileManagerTemplate.h \
         $$PWD/../include/files/draupnir/files/managers/SingleFileManagerTemplate.h
 
     SOURCES += \
+        $$PWD/../src/files/core/AtomicFileWriter.cpp \
+        $$PWD/../src/files/core/ContentHasher.cpp \
+        $$PWD/../src/files/core/FileWatcherService.cpp \
+        $$PWD/../src/files/core/JsonStreamReader.cpp \
+        $$PWD/../src/files/core/JsonStreamWriter.cpp \
+        $$PWD/../src/files/core/ParallelFileReader.cpp \
         $$PWD/../src/files/file_types/AbstractFile.cpp
 }
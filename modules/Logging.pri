@@ -18,12 +18,17 @@
         $$PWD/../include/logging/draupnir/logging/Logger.h \
         $$PWD/../include/logging/draupnir/logging/core/AbstractMessageHandler.h \
         $$PWD/../include/logging/draupnir/logging/core/AbstractMessageViewIconProvider.h \
+        $$PWD/../include/logging/draupnir/logging/core/MessageGroupBuffer.h \
+        $$PWD/../include/logging/draupnir/logging/core/MessageSampler.h \
+        $$PWD/../include/logging/draupnir/logging/core/MessageStream.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageCategories.h \
+        $$PWD/../include/logging/draupnir/logging/messages/MessageFields.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageGroup.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageLevels.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageTypes.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageViewItem.h \
         $$PWD/../include/logging/draupnir/logging/messages/MessageViewItemFields.h \
+        $$PWD/../include/logging/draupnir/logging/models/MessageListImporter.h \
         $$PWD/../include/logging/draupnir/logging/models/MessageListModel.h \
         $$PWD/../include/logging/draupnir/logging/models/MessageListProxyModel.h \
         $$PWD/../include/logging/draupnir/logging/traits/categories/DefaultMessageCategory.h \
@@ -37,7 +42,11 @@
     SOURCES += \
         $$PWD/../src/logging/draupnir/Logger.cpp \
         $$PWD/../src/logging/draupnir/core/AbstractMessageViewIconProvider.cpp \
+        $$PWD/../src/logging/draupnir/core/MessageStream.cpp \
+        $$PWD/../src/logging/draupnir/messages/MessageCategories.cpp \
+        $$PWD/../src/logging/draupnir/messages/MessageFields.cpp \
         $$PWD/../src/logging/draupnir/messages/MessageViewItem.cpp \
+        $$PWD/../src/logging/draupnir/models/MessageListImporter.cpp \
         $$PWD/../src/logging/draupnir/models/MessageListModel.cpp \
         $$PWD/../src/logging/draupnir/models/MessageListProxyModel.cpp \
         $$PWD/../src/logging/draupnir/ui/widgets/MessageDisplayWidget.cpp \
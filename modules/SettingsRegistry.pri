@@ -45,25 +45,37 @@
 
     contains(DEFINES, DRAUPNIR_SETTINGS_USE_CUSTOM) {
         HEADERS += \
-            $$PWD/../include/settings_registry/draupnir/settings_registry/core/SettingsBackendInterface.h
+            $$PWD/../include/settings_registry/draupnir/settings_registry/core/BinarySettingsBackend.h \
+            $$PWD/../include/settings_registry/draupnir/settings_registry/core/InMemorySettingsBackend.h \
+            $$PWD/../include/settings_registry/draupnir/settings_registry/core/SettingsBackendInterface.h \
+            $$PWD/../include/settings_registry/draupnir/settings_registry/core/TypedSettingsBackendInterface.h
+
+        SOURCES += \
+            $$PWD/../src/settings_registry/draupnir/core/BinarySettingsBackend.cpp
     }
 
     HEADERS += \
         $$PWD/../include/settings_registry/draupnir/SettingsRegistry.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/ConcurrentSettingsRegistryTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/SettingsBundleTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/SettingsRegistryTemplate.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/SettingsSnapshotTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/concepts/SettingsBackendConcept.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/concepts/SettingsBundleConcept.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/concepts/SettingTraitConcept.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/core/ConcurrentValueTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/core/SettingTemplate.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/core/SettingsWriteBehindInterface.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/traits/settings/files/LastUsedDirectorySetting.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/traits/settings/files/RecentFilesListSetting.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/traits/settings/templates/SettingTraitTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/traits/settings/templates/SizeSettingTraitTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/utils/OptionalSettingsBundle.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/utils/SettingsTraitsConcatenator.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/utils/SettingTraitKey.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/utils/SettingTraitPrinter.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/utils/SettingTraitSerializer.h \
+        $$PWD/../include/settings_registry/draupnir/settings_registry/utils/TypedValueSerializerTemplate.h \
         $$PWD/../include/settings_registry/draupnir/settings_registry/utils/ValueSerializerTemplate.h
 
     DISTFILES += \
@@ -19,6 +19,7 @@
         $$PWD/../include/utils/draupnir/utils/integer_normalization.h \
         $$PWD/../include/utils/draupnir/utils/integer_wrapper.h \
         $$PWD/../include/utils/draupnir/utils/sfinae_detector_macro.h \
+        $$PWD/../include/utils/draupnir/utils/static_perfect_hash.h \
         $$PWD/../include/utils/draupnir/utils/template_adapters.h \
         $$PWD/../include/utils/draupnir/utils/template_constructors.h \
         $$PWD/../include/utils/draupnir/utils/template_detectors.h \
@@ -0,0 +1,160 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/AtomicFileWriter.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QObject>
+#include <QRandomGenerator>
+
+#if defined(Q_OS_WIN)
+#include <io.h>
+#include <windows.h>
+#elif defined(Q_OS_UNIX)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Draupnir::Files
+{
+
+namespace {
+
+/*! @brief Flushes OS buffers of the opened file to the storage device according to @p syncPolicy. */
+bool _syncFile(QFile& file, FileSyncPolicy syncPolicy)
+{
+    if (syncPolicy == FileSyncPolicy::None)
+        return true;
+
+#if defined(Q_OS_WIN)
+    return ::FlushFileBuffers(reinterpret_cast<HANDLE>(::_get_osfhandle(file.handle()))) != 0;
+#elif defined(Q_OS_LINUX)
+    return (syncPolicy == FileSyncPolicy::Data) ?
+        ::fdatasync(file.handle()) == 0 :
+        ::fsync(file.handle()) == 0;
+#elif defined(Q_OS_UNIX)
+    return ::fsync(file.handle()) == 0;
+#else
+    Q_UNUSED(file);
+    return true;
+#endif
+}
+
+/*! @brief Syncs directory entry, so the rename survives a power loss. Only needed for FileSyncPolicy::Full. */
+void _syncDirectory(const QString& directoryPath)
+{
+#if defined(Q_OS_UNIX)
+    const int directoryHandle = ::open(QFile::encodeName(directoryPath).constData(), O_RDONLY);
+    if (directoryHandle < 0)
+        return;
+
+    ::fsync(directoryHandle);
+    ::close(directoryHandle);
+#else
+    // On Windows MOVEFILE_WRITE_THROUGH already waits for the rename to be flushed.
+    Q_UNUSED(directoryPath);
+#endif
+}
+
+/*! @brief Replaces @p targetPath with @p sourcePath, overwriting existing target. */
+std::expected<void,QString> _replaceFile(const QString& sourcePath, const QString& targetPath)
+{
+#if defined(Q_OS_WIN)
+    const QString nativeSource = QDir::toNativeSeparators(sourcePath);
+    const QString nativeTarget = QDir::toNativeSeparators(targetPath);
+    if (!::MoveFileExW(reinterpret_cast<LPCWSTR>(nativeSource.utf16()), reinterpret_cast<LPCWSTR>(nativeTarget.utf16()),
+                       MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        return std::unexpected(QObject::tr("Error code: %1").arg(::GetLastError()));
+    }
+#else
+    if (::rename(QFile::encodeName(sourcePath).constData(), QFile::encodeName(targetPath).constData()) != 0)
+        return std::unexpected(QString::fromLocal8Bit(std::strerror(errno)));
+#endif
+    return {};
+}
+
+}; // namespace
+
+std::expected<void,QString> AtomicFileWriter::write(const QString& filePath, const QByteArray& data,
+                                                    QIODevice::OpenMode extraFlags, FileSyncPolicy syncPolicy)
+{
+    QFileInfo targetInfo{filePath};
+    // Replacing the link itself would silently detach it from the file it points to.
+    if (targetInfo.isSymLink())
+        targetInfo = QFileInfo{targetInfo.symLinkTarget()};
+
+    const QString targetPath = targetInfo.absoluteFilePath();
+    const bool targetExists = targetInfo.exists();
+    // Rename needs only directory permissions, so read-only files have to be checked explicitly.
+    if (targetExists && !targetInfo.isWritable()) {
+        return std::unexpected(QObject::tr("Error opening file %1.\r\n%2")
+                                   .arg(filePath).arg(QObject::tr("Permission denied")));
+    }
+
+    const QString tempPath = targetInfo.absoluteDir().filePath(QStringLiteral(".%1.%2.tmp")
+        .arg(targetInfo.fileName())
+        .arg(QRandomGenerator::global()->generate(), 8, 16, QLatin1Char{'0'}));
+
+    QFile file{tempPath};
+    if (!file.open(QIODevice::WriteOnly | QIODevice::NewOnly | extraFlags))
+        return std::unexpected(QObject::tr("Error opening file %1.\r\n%2").arg(filePath).arg(file.errorString()));
+
+    const auto fail = [&file](const QString& error) -> std::expected<void,QString> {
+        file.close();
+        file.remove();
+        return std::unexpected(error);
+    };
+
+    if (targetExists)
+        file.setPermissions(targetInfo.permissions());
+
+    const qint64 bytesWritten = file.write(data);
+    if (bytesWritten != data.size())
+        return fail(QObject::tr("Error writing file %1.\r\n%2").arg(filePath).arg(file.errorString()));
+
+    if (!file.flush())
+        return fail(QObject::tr("Error flushing file %1.\r\n%2").arg(filePath).arg(file.errorString()));
+
+    if (!_syncFile(file, syncPolicy))
+        return fail(QObject::tr("Error syncing file %1 to disk.").arg(filePath));
+
+    file.close();
+
+    if (const auto replaced = _replaceFile(tempPath, targetPath); !replaced) {
+        QFile::remove(tempPath);
+        return std::unexpected(QObject::tr("Error replacing file %1.\r\n%2").arg(filePath).arg(replaced.error()));
+    }
+
+    if (syncPolicy == FileSyncPolicy::Full)
+        _syncDirectory(targetInfo.absolutePath());
+
+    return {};
+}
+
+}; // namespace Draupnir::Files
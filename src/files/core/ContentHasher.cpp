@@ -0,0 +1,171 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/ContentHasher.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+namespace Draupnir::Files
+{
+
+namespace {
+
+constexpr quint64 prime1 = 0x9E3779B185EBCA87ULL;
+constexpr quint64 prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr quint64 prime3 = 0x165667B19E3779F9ULL;
+constexpr quint64 prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr quint64 prime5 = 0x27D4EB2F165667C5ULL;
+
+constexpr quint64 _rotateLeft(quint64 value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline quint64 _read64(const char* data)
+{
+    return qFromLittleEndian<quint64>(data);
+}
+
+inline quint32 _read32(const char* data)
+{
+    return qFromLittleEndian<quint32>(data);
+}
+
+constexpr quint64 _round(quint64 accumulator, quint64 input)
+{
+    accumulator += input * prime2;
+    accumulator = _rotateLeft(accumulator, 31);
+    return accumulator * prime1;
+}
+
+constexpr quint64 _mergeRound(quint64 hash, quint64 accumulator)
+{
+    hash ^= _round(0, accumulator);
+    return hash * prime1 + prime4;
+}
+
+}; // namespace
+
+ContentHasher::ContentHasher(quint64 seed) :
+    m_seed{seed}
+{
+    reset();
+}
+
+void ContentHasher::reset()
+{
+    m_accumulators[0] = m_seed + prime1 + prime2;
+    m_accumulators[1] = m_seed + prime2;
+    m_accumulators[2] = m_seed;
+    m_accumulators[3] = m_seed - prime1;
+    m_bufferSize = 0;
+    m_totalSize = 0;
+}
+
+void ContentHasher::addData(const char* data, qint64 size)
+{
+    m_totalSize += size;
+
+    // Complete stripe left from the previous call first.
+    if (m_bufferSize > 0) {
+        const int toCopy = static_cast<int>(qMin<qint64>(size, sizeof(m_buffer) - m_bufferSize));
+        std::memcpy(m_buffer + m_bufferSize, data, toCopy);
+        m_bufferSize += toCopy;
+        data += toCopy;
+        size -= toCopy;
+
+        if (m_bufferSize < static_cast<int>(sizeof(m_buffer)))
+            return;
+
+        for (int i = 0; i < 4; i++)
+            m_accumulators[i] = _round(m_accumulators[i], _read64(m_buffer + i * 8));
+        m_bufferSize = 0;
+    }
+
+    while (size >= static_cast<qint64>(sizeof(m_buffer))) {
+        for (int i = 0; i < 4; i++)
+            m_accumulators[i] = _round(m_accumulators[i], _read64(data + i * 8));
+        data += sizeof(m_buffer);
+        size -= sizeof(m_buffer);
+    }
+
+    if (size > 0) {
+        std::memcpy(m_buffer, data, size);
+        m_bufferSize = static_cast<int>(size);
+    }
+}
+
+quint64 ContentHasher::result() const
+{
+    quint64 hash;
+    if (m_totalSize >= static_cast<qint64>(sizeof(m_buffer))) {
+        hash = _rotateLeft(m_accumulators[0], 1) + _rotateLeft(m_accumulators[1], 7) +
+               _rotateLeft(m_accumulators[2], 12) + _rotateLeft(m_accumulators[3], 18);
+        for (int i = 0; i < 4; i++)
+            hash = _mergeRound(hash, m_accumulators[i]);
+    } else {
+        hash = m_seed + prime5;
+    }
+
+    hash += static_cast<quint64>(m_totalSize);
+
+    const char* data = m_buffer;
+    int remaining = m_bufferSize;
+    while (remaining >= 8) {
+        hash ^= _round(0, _read64(data));
+        hash = _rotateLeft(hash, 27) * prime1 + prime4;
+        data += 8;
+        remaining -= 8;
+    }
+    if (remaining >= 4) {
+        hash ^= static_cast<quint64>(_read32(data)) * prime1;
+        hash = _rotateLeft(hash, 23) * prime2 + prime3;
+        data += 4;
+        remaining -= 4;
+    }
+    while (remaining > 0) {
+        hash ^= static_cast<quint64>(static_cast<quint8>(*data)) * prime5;
+        hash = _rotateLeft(hash, 11) * prime1;
+        data++;
+        remaining--;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+quint64 ContentHasher::hash(const QByteArray& data, quint64 seed)
+{
+    ContentHasher hasher{seed};
+    hasher.addData(data);
+    return hasher.result();
+}
+
+}; // namespace Draupnir::Files
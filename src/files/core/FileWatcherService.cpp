@@ -0,0 +1,182 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/FileWatcherService.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPointer>
+#include <QThread>
+
+#include "draupnir/files/file_types/AbstractFile.h"
+
+namespace Draupnir::Files
+{
+
+FileWatcherService* FileWatcherService::instance()
+{
+    static QMutex instanceMutex;
+    static QPointer<FileWatcherService> theOne;
+
+    QMutexLocker locker{&instanceMutex};
+    if (theOne.isNull()) {
+        // Service is deleted together with QCoreApplication. Files destroyed after it have nothing to unregister from.
+        QCoreApplication* application = QCoreApplication::instance();
+        if (application == nullptr)
+            return nullptr;
+
+        // First call may come from a worker thread, while the service must live where QCoreApplication does.
+        FileWatcherService* service = new FileWatcherService;
+        service->moveToThread(application->thread());
+        service->setParent(application);
+        theOne = service;
+    }
+
+    return theOne;
+}
+
+FileWatcherService::FileWatcherService(QObject* parent) :
+    QObject{parent},
+    m_watcher{this},
+    m_dispatchTimer{this},
+    m_debounceInterval{defaultDebounceInterval}
+{
+    m_clock.start();
+    m_dispatchTimer.setSingleShot(true);
+
+    connect(&m_watcher, &QFileSystemWatcher::fileChanged,
+            this, &FileWatcherService::_onRawFileChanged);
+    connect(&m_dispatchTimer, &QTimer::timeout,
+            this, &FileWatcherService::_dispatchPending);
+}
+
+void FileWatcherService::setDebounceInterval(int milliseconds)
+{
+    Q_ASSERT_X(milliseconds >= 0, "FileWatcherService::setDebounceInterval", "Interval can not be negative.");
+    m_debounceInterval = milliseconds;
+}
+
+void FileWatcherService::watch(const QString& filePath, AbstractFile* file)
+{
+    if (filePath.isEmpty())
+        return;
+
+    {
+        QMutexLocker locker{&m_filesMutex};
+        if (!m_files.contains(filePath, file))
+            m_files.insert(filePath, file);
+    }
+
+    // Also covers files which did not exist while being registered for the first time.
+    _invokeOnServiceThread([this, filePath]() { _rearm(filePath); });
+}
+
+void FileWatcherService::unwatch(const QString& filePath, AbstractFile* file)
+{
+    {
+        QMutexLocker locker{&m_filesMutex};
+        if (m_files.remove(filePath, file) == 0 || m_files.contains(filePath))
+            return;
+    }
+
+    _invokeOnServiceThread([this, filePath]() { _release(filePath); });
+}
+
+bool FileWatcherService::isWatched(const QString& filePath) const
+{
+    QMutexLocker locker{&m_filesMutex};
+    return m_files.contains(filePath);
+}
+
+void FileWatcherService::_onRawFileChanged(const QString& filePath)
+{
+    if (!isWatched(filePath))
+        return;
+
+    _rearm(filePath);
+
+    m_pendingDeadlines.insert(filePath, m_clock.elapsed() + m_debounceInterval);
+    if (!m_dispatchTimer.isActive())
+        m_dispatchTimer.start(m_debounceInterval);
+}
+
+void FileWatcherService::_dispatchPending()
+{
+    const qint64 now = m_clock.elapsed();
+    qint64 nextDeadline = -1;
+    QStringList readyPaths;
+
+    for (auto it = m_pendingDeadlines.begin(); it != m_pendingDeadlines.end();) {
+        if (it.value() <= now) {
+            readyPaths.append(it.key());
+            it = m_pendingDeadlines.erase(it);
+        } else {
+            nextDeadline = (nextDeadline < 0) ? it.value() : qMin(nextDeadline, it.value());
+            ++it;
+        }
+    }
+
+    if (nextDeadline >= 0)
+        m_dispatchTimer.start(static_cast<int>(nextDeadline - now));
+
+    for (const QString& filePath : std::as_const(readyPaths)) {
+        // File may have been recreated after the raw event was received.
+        _rearm(filePath);
+
+        // Files may unregister themselves (or be deleted) while being notified, so receivers are copied.
+        QMutexLocker locker{&m_filesMutex};
+        const QList<AbstractFile*> files = m_files.values(filePath);
+        for (AbstractFile* file : files) {
+            if (m_files.contains(filePath, file))
+                file->_onFileChanged(filePath);
+        }
+    }
+}
+
+void FileWatcherService::_rearm(const QString& filePath)
+{
+    if (isWatched(filePath) && !m_watcher.files().contains(filePath) && QFile::exists(filePath))
+        m_watcher.addPath(filePath);
+}
+
+void FileWatcherService::_release(const QString& filePath)
+{
+    if (isWatched(filePath))
+        return;
+
+    m_pendingDeadlines.remove(filePath);
+    m_watcher.removePath(filePath);
+}
+
+void FileWatcherService::_invokeOnServiceThread(std::function<void()> function)
+{
+    if (QThread::currentThread() == thread())
+        function();
+    else
+        QMetaObject::invokeMethod(this, std::move(function), Qt::QueuedConnection);
+}
+
+}; // namespace Draupnir::Files
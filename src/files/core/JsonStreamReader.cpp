@@ -0,0 +1,393 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/JsonStreamReader.h"
+
+#include <QObject>
+
+namespace Draupnir::Files
+{
+
+namespace {
+
+bool isJsonWhitespace(char character)
+{
+    return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+}
+
+bool isDigit(char character)
+{
+    return character >= '0' && character <= '9';
+}
+
+bool isLiteralCharacter(char character)
+{
+    return isDigit(character) ||
+           (character >= 'a' && character <= 'z') ||
+           (character >= 'A' && character <= 'Z') ||
+           character == '-' || character == '+' || character == '.';
+}
+
+int hexDigitValue(char character)
+{
+    if (character >= '0' && character <= '9')
+        return character - '0';
+    if (character >= 'a' && character <= 'f')
+        return character - 'a' + 10;
+    if (character >= 'A' && character <= 'F')
+        return character - 'A' + 10;
+    return -1;
+}
+
+/*! @brief Returns `true` if @p token follows the JSON number grammar: `-?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?`. */
+bool isJsonNumber(const QByteArray& token)
+{
+    const qsizetype size = token.size();
+    qsizetype index = 0;
+
+    if (index < size && token.at(index) == '-')
+        index++;
+
+    if (index >= size || !isDigit(token.at(index)))
+        return false;
+    if (token.at(index++) != '0') {
+        while (index < size && isDigit(token.at(index)))
+            index++;
+    }
+
+    if (index < size && token.at(index) == '.') {
+        const qsizetype fractionStart = ++index;
+        while (index < size && isDigit(token.at(index)))
+            index++;
+        if (index == fractionStart)
+            return false;
+    }
+
+    if (index < size && (token.at(index) == 'e' || token.at(index) == 'E')) {
+        index++;
+        if (index < size && (token.at(index) == '+' || token.at(index) == '-'))
+            index++;
+        const qsizetype exponentStart = index;
+        while (index < size && isDigit(token.at(index)))
+            index++;
+        if (index == exponentStart)
+            return false;
+    }
+
+    return index == size;
+}
+
+/*! @brief Decodes contents of a JSON string (without quotes). Unescaped runs are always split on ASCII characters, so
+ *         multi-byte UTF-8 sequences are never cut. */
+std::expected<QString,QString> decodeJsonString(const QByteArray& rawString)
+{
+    const char* const data = rawString.constData();
+    const qsizetype size = rawString.size();
+
+    QString result;
+    result.reserve(size);
+
+    qsizetype runStart = 0;
+    qsizetype index = 0;
+    while (index < size) {
+        const char character = data[index];
+        if (static_cast<uchar>(character) < 0x20)
+            return std::unexpected{QObject::tr("Unescaped control character in string")};
+
+        if (character != '\\') {
+            index++;
+            continue;
+        }
+
+        result.append(QString::fromUtf8(data + runStart, index - runStart));
+        index++;
+
+        // Closing quote is never escaped, so escape character is always present.
+        switch (data[index]) {
+        case '"':  result.append(QLatin1Char('"'));  break;
+        case '\\': result.append(QLatin1Char('\\')); break;
+        case '/':  result.append(QLatin1Char('/'));  break;
+        case 'b':  result.append(QLatin1Char('\b')); break;
+        case 'f':  result.append(QLatin1Char('\f')); break;
+        case 'n':  result.append(QLatin1Char('\n')); break;
+        case 'r':  result.append(QLatin1Char('\r')); break;
+        case 't':  result.append(QLatin1Char('\t')); break;
+        case 'u': {
+            if (index + 4 >= size)
+                return std::unexpected{QObject::tr("Invalid unicode escape sequence in string")};
+
+            ushort codeUnit = 0;
+            for (qsizetype digit = 1; digit <= 4; digit++) {
+                const int value = hexDigitValue(data[index + digit]);
+                if (value < 0)
+                    return std::unexpected{QObject::tr("Invalid unicode escape sequence in string")};
+                codeUnit = static_cast<ushort>((codeUnit << 4) | value);
+            }
+            // Surrogate pairs are escaped as two code units, QString stores them the same way.
+            result.append(QChar{codeUnit});
+            index += 4;
+            break;
+        }
+        default:
+            return std::unexpected{QObject::tr("Invalid escape sequence in string")};
+        }
+
+        runStart = ++index;
+    }
+
+    result.append(QString::fromUtf8(data + runStart, size - runStart));
+    return result;
+}
+
+}; // namespace
+
+JsonStreamReader::JsonStreamReader(JsonStreamHandler* handler) :
+    p_handler{handler}
+{
+    Q_ASSERT_X(p_handler, "JsonStreamReader::JsonStreamReader", "Handler must be provided.");
+    reset();
+}
+
+void JsonStreamReader::reset()
+{
+    m_state = State::ExpectValue;
+    m_token = Token::None;
+    m_escaped = false;
+    m_failed = false;
+    m_tokenData.clear();
+    m_containers.clear();
+    m_bytesProcessed = 0;
+}
+
+std::expected<void,QString> JsonStreamReader::addData(const char* data, qint64 size)
+{
+    if (m_failed)
+        return std::unexpected{QObject::tr("JSON reader must be reset after an error.")};
+
+    const char* const end = data + size;
+    const char* current = data;
+    auto offsetOf = [this, data](const char* position) { return m_bytesProcessed + (position - data); };
+
+    while (current < end) {
+        if (m_token == Token::String) {
+            const char* const tokenStart = current;
+            while (current < end) {
+                const char character = *current;
+                if (m_escaped)
+                    m_escaped = false;
+                else if (character == '\\')
+                    m_escaped = true;
+                else if (character == '"')
+                    break;
+                current++;
+            }
+            m_tokenData.append(tokenStart, current - tokenStart);
+            if (current == end)
+                break;
+
+            m_token = Token::None;
+            if (auto result = _stringParsed(offsetOf(current)); !result)
+                return result;
+            current++;
+            continue;
+        }
+
+        if (m_token == Token::Literal) {
+            const char* const tokenStart = current;
+            while (current < end && isLiteralCharacter(*current))
+                current++;
+            m_tokenData.append(tokenStart, current - tokenStart);
+            if (current == end)
+                break;
+
+            m_token = Token::None;
+            if (auto result = _literalParsed(offsetOf(current)); !result)
+                return result;
+            continue;
+        }
+
+        const char character = *current;
+        if (isJsonWhitespace(character)) {
+            current++;
+        } else if (character == '"') {
+            if (!_isValueExpected() && m_state != State::ExpectKey && m_state != State::ExpectKeyOrObjectEnd)
+                return _error(QObject::tr("Unexpected string"), offsetOf(current));
+            m_token = Token::String;
+            m_tokenData.clear();
+            current++;
+        } else if (character == '-' || isDigit(character) || (character >= 'a' && character <= 'z')) {
+            if (!_isValueExpected())
+                return _error(QObject::tr("Unexpected value"), offsetOf(current));
+            m_token = Token::Literal;
+            m_tokenData.clear();
+        } else {
+            if (auto result = _structuralCharacterParsed(character, offsetOf(current)); !result)
+                return result;
+            current++;
+        }
+    }
+
+    m_bytesProcessed += size;
+    return {};
+}
+
+std::expected<void,QString> JsonStreamReader::finish()
+{
+    if (m_failed)
+        return std::unexpected{QObject::tr("JSON reader must be reset after an error.")};
+
+    if (m_token == Token::String)
+        return _error(QObject::tr("Unterminated string"), m_bytesProcessed);
+
+    if (m_token == Token::Literal) {
+        m_token = Token::None;
+        if (auto result = _literalParsed(m_bytesProcessed); !result)
+            return result;
+    }
+
+    if (m_state != State::Done)
+        return _error(QObject::tr("Unexpected end of data"), m_bytesProcessed);
+
+    return {};
+}
+
+std::expected<void,QString> JsonStreamReader::_structuralCharacterParsed(char character, qint64 offset)
+{
+    switch (character) {
+    case '{':
+    case '[':
+        return _containerStarted(character, offset);
+    case '}':
+    case ']':
+        return _containerFinished(character, offset);
+    case ':':
+        if (m_state != State::ExpectColon)
+            return _error(QObject::tr("Unexpected ':'"), offset);
+        m_state = State::ExpectValue;
+        return {};
+    case ',':
+        if (m_state != State::ExpectCommaOrEnd)
+            return _error(QObject::tr("Unexpected ','"), offset);
+        m_state = (m_containers.back() == '{') ? State::ExpectKey : State::ExpectValue;
+        return {};
+    default:
+        return _error(QObject::tr("Unexpected character '%1'").arg(QLatin1Char(character)), offset);
+    }
+}
+
+std::expected<void,QString> JsonStreamReader::_containerStarted(char container, qint64 offset)
+{
+    if (!_isValueExpected())
+        return _error(QObject::tr("Unexpected '%1'").arg(QLatin1Char(container)), offset);
+    if (m_containers.size() >= maximumDepth)
+        return _error(QObject::tr("Maximum nesting depth exceeded"), offset);
+
+    m_containers.append(container);
+    if (container == '{') {
+        m_state = State::ExpectKeyOrObjectEnd;
+        auto result = p_handler->jsonObjectStarted();
+        m_failed = !result.has_value();
+        return result;
+    }
+
+    m_state = State::ExpectValueOrArrayEnd;
+    auto result = p_handler->jsonArrayStarted();
+    m_failed = !result.has_value();
+    return result;
+}
+
+std::expected<void,QString> JsonStreamReader::_containerFinished(char container, qint64 offset)
+{
+    const char opening = (container == '}') ? '{' : '[';
+    const State emptyContainerState = (container == '}') ? State::ExpectKeyOrObjectEnd : State::ExpectValueOrArrayEnd;
+
+    const bool canFinish =
+        !m_containers.isEmpty() &&
+        m_containers.back() == opening &&
+        (m_state == State::ExpectCommaOrEnd || m_state == emptyContainerState);
+    if (!canFinish)
+        return _error(QObject::tr("Unexpected '%1'").arg(QLatin1Char(container)), offset);
+
+    m_containers.chop(1);
+    _valueParsed();
+
+    auto result = (container == '}') ? p_handler->jsonObjectFinished() : p_handler->jsonArrayFinished();
+    m_failed = !result.has_value();
+    return result;
+}
+
+std::expected<void,QString> JsonStreamReader::_stringParsed(qint64 offset)
+{
+    auto decoded = decodeJsonString(m_tokenData);
+    if (!decoded)
+        return _error(decoded.error(), offset);
+
+    std::expected<void,QString> result;
+    if (m_state == State::ExpectKey || m_state == State::ExpectKeyOrObjectEnd) {
+        m_state = State::ExpectColon;
+        result = p_handler->jsonKeyParsed(decoded.value());
+    } else {
+        _valueParsed();
+        result = p_handler->jsonValueParsed(QJsonValue{decoded.value()});
+    }
+
+    m_failed = !result.has_value();
+    return result;
+}
+
+std::expected<void,QString> JsonStreamReader::_literalParsed(qint64 offset)
+{
+    QJsonValue value;
+    if (m_tokenData == "true") {
+        value = QJsonValue{true};
+    } else if (m_tokenData == "false") {
+        value = QJsonValue{false};
+    } else if (m_tokenData == "null") {
+        value = QJsonValue{QJsonValue::Null};
+    } else if (isJsonNumber(m_tokenData)) {
+        bool isInteger = false;
+        const qint64 integer = m_tokenData.toLongLong(&isInteger);
+        value = isInteger ? QJsonValue{integer} : QJsonValue{m_tokenData.toDouble()};
+    } else {
+        return _error(QObject::tr("Invalid value '%1'").arg(QString::fromLatin1(m_tokenData)), offset - m_tokenData.size());
+    }
+
+    _valueParsed();
+    auto result = p_handler->jsonValueParsed(value);
+    m_failed = !result.has_value();
+    return result;
+}
+
+void JsonStreamReader::_valueParsed()
+{
+    m_state = m_containers.isEmpty() ? State::Done : State::ExpectCommaOrEnd;
+}
+
+std::expected<void,QString> JsonStreamReader::_error(const QString& message, qint64 offset)
+{
+    m_failed = true;
+    return std::unexpected{QObject::tr("Invalid JSON at offset %1: %2.").arg(offset).arg(message)};
+}
+
+}; // namespace Draupnir::Files
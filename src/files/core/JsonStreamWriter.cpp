@@ -0,0 +1,218 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/JsonStreamWriter.h"
+
+#include <QCborValue>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QLocale>
+#include <QtNumeric>
+
+namespace Draupnir::Files
+{
+
+JsonStreamWriter::JsonStreamWriter(QByteArray* output, QJsonDocument::JsonFormat format) :
+    p_output{output},
+    m_format{format},
+    m_containerIsEmpty{true},
+    m_keyWritten{false}
+{
+    Q_ASSERT_X(p_output, "JsonStreamWriter::JsonStreamWriter", "Output must be provided.");
+}
+
+void JsonStreamWriter::beginObject()
+{
+    _beginContainer('{');
+}
+
+void JsonStreamWriter::endObject()
+{
+    _endContainer('}');
+}
+
+void JsonStreamWriter::beginArray()
+{
+    _beginContainer('[');
+}
+
+void JsonStreamWriter::endArray()
+{
+    _endContainer(']');
+}
+
+void JsonStreamWriter::writeKey(const QString& key)
+{
+    Q_ASSERT_X(!m_containers.isEmpty() && m_containers.back() == '{' && !m_keyWritten, "JsonStreamWriter::writeKey",
+               "Keys may be written only within objects, once per member.");
+
+    _beforeElement();
+    _writeString(key);
+    p_output->append(_isIndented() ? ": " : ":");
+    m_keyWritten = true;
+}
+
+void JsonStreamWriter::writeValue(const QJsonValue& value)
+{
+    switch (value.type()) {
+    case QJsonValue::Object: {
+        const QJsonObject object = value.toObject();
+        beginObject();
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it)
+            writeMember(it.key(), it.value());
+        endObject();
+        return;
+    }
+    case QJsonValue::Array: {
+        const QJsonArray array = value.toArray();
+        beginArray();
+        for (const QJsonValue& element : array)
+            writeValue(element);
+        endArray();
+        return;
+    }
+    default:
+        break;
+    }
+
+    _beforeElement();
+    switch (value.type()) {
+    case QJsonValue::Bool:
+        p_output->append(value.toBool() ? "true" : "false");
+        break;
+    case QJsonValue::Double: {
+        // Integers beyond 2^53 are kept by QJsonValue exactly and must not be written through double.
+        if (const QCborValue cborValue = QCborValue::fromJsonValue(value); cborValue.isInteger()) {
+            p_output->append(QByteArray::number(cborValue.toInteger()));
+            break;
+        }
+        const double number = value.toDouble();
+        if (qIsFinite(number))
+            p_output->append(QByteArray::number(number, 'g', QLocale::FloatingPointShortest));
+        else
+            p_output->append("null");
+        break;
+    }
+    case QJsonValue::String:
+        _writeString(value.toString());
+        break;
+    default:
+        p_output->append("null");
+        break;
+    }
+    _elementWritten();
+}
+
+void JsonStreamWriter::_beforeElement()
+{
+    if (m_keyWritten) {
+        // Separator was written together with the key.
+        m_keyWritten = false;
+        return;
+    }
+
+    if (m_containers.isEmpty())
+        return;
+
+    if (!m_containerIsEmpty)
+        p_output->append(_isIndented() ? ",\n" : ",");
+    if (_isIndented())
+        p_output->append(QByteArray(4 * m_containers.size(), ' '));
+}
+
+void JsonStreamWriter::_beginContainer(char container)
+{
+    _beforeElement();
+    p_output->append(container);
+    if (_isIndented())
+        p_output->append('\n');
+
+    m_containers.append(container);
+    m_containerIsEmpty = true;
+}
+
+void JsonStreamWriter::_endContainer(char container)
+{
+    Q_ASSERT_X(!m_containers.isEmpty() && m_containers.back() == ((container == '}') ? '{' : '[') && !m_keyWritten,
+               "JsonStreamWriter::_endContainer", "Closed container does not match the opened one.");
+
+    m_containers.chop(1);
+    if (_isIndented()) {
+        if (!m_containerIsEmpty)
+            p_output->append('\n');
+        p_output->append(QByteArray(4 * m_containers.size(), ' '));
+    }
+    p_output->append(container);
+
+    // Same as QJsonDocument::toJson, indented document ends with a new line.
+    if (_isIndented() && m_containers.isEmpty())
+        p_output->append('\n');
+
+    _elementWritten();
+}
+
+void JsonStreamWriter::_writeString(const QString& string)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+
+    const QByteArray utf8 = string.toUtf8();
+    const char* const data = utf8.constData();
+    const qsizetype size = utf8.size();
+
+    p_output->append('"');
+    qsizetype runStart = 0;
+    for (qsizetype index = 0; index < size; index++) {
+        const uchar character = static_cast<uchar>(data[index]);
+        if (character >= 0x20 && character != '"' && character != '\\')
+            continue;
+
+        p_output->append(data + runStart, index - runStart);
+        runStart = index + 1;
+
+        p_output->append('\\');
+        switch (character) {
+        case '"':  p_output->append('"');  break;
+        case '\\': p_output->append('\\'); break;
+        case '\b': p_output->append('b');  break;
+        case '\f': p_output->append('f');  break;
+        case '\n': p_output->append('n');  break;
+        case '\r': p_output->append('r');  break;
+        case '\t': p_output->append('t');  break;
+        default:
+            p_output->append("u00");
+            p_output->append(hexDigits[character >> 4]);
+            p_output->append(hexDigits[character & 0xf]);
+            break;
+        }
+    }
+    p_output->append(data + runStart, size - runStart);
+    p_output->append('"');
+}
+
+void JsonStreamWriter::_elementWritten()
+{
+    m_containerIsEmpty = false;
+}
+
+}; // namespace Draupnir::Files
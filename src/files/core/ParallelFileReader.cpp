@@ -0,0 +1,109 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "draupnir/files/core/ParallelFileReader.h"
+
+#include <QMutex>
+#include <QPair>
+#include <QQueue>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+#include <optional>
+#include <vector>
+
+#include "draupnir/files/file_types/AbstractFile.h"
+
+namespace Draupnir::Files
+{
+
+ParallelFileReader::ParallelFileReader() :
+    m_maxThreadCount{qMax(1, QThread::idealThreadCount())}
+{}
+
+void ParallelFileReader::setMaxThreadCount(int count)
+{
+    m_maxThreadCount = qMax(1, count);
+}
+
+QList<ParallelFileReader::Result> ParallelFileReader::read(const QList<AbstractFile*>& files, const QList<QFileInfo>& fileInfos,
+                                                           ResultOrder order, const ResultHandler& handler) const
+{
+    Q_ASSERT_X(files.size() == fileInfos.size(), "ParallelFileReader::read",
+               "Amount of files and file infos must be the same.");
+
+    const int count = files.size();
+    QMutex mutex;
+    QWaitCondition resultReady;
+    QQueue<QPair<int,Result>> completed;
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_maxThreadCount);
+    for (int index = 0; index < count; index++) {
+        pool.start(QRunnable::create([&files, &fileInfos, &mutex, &resultReady, &completed, index]() {
+            Result result = files.at(index)->readFile(fileInfos.at(index));
+
+            QMutexLocker locker{&mutex};
+            completed.enqueue(qMakePair(index, std::move(result)));
+            resultReady.wakeOne();
+        }));
+    }
+
+    std::vector<std::optional<Result>> received(count);
+    int nextInOrder = 0;
+    for (int receivedCount = 0; receivedCount < count; receivedCount++) {
+        QPair<int,Result> item;
+        {
+            QMutexLocker locker{&mutex};
+            while (completed.isEmpty())
+                resultReady.wait(&mutex);
+            item = completed.dequeue();
+        }
+        received[item.first] = std::move(item.second);
+
+        if (!handler)
+            continue;
+
+        if (order == ResultOrder::AsCompleted) {
+            handler(item.first, received[item.first].value());
+        } else {
+            // Deliver everything which is ready and not blocked by a file still being read.
+            while (nextInOrder < count && received[nextInOrder].has_value()) {
+                handler(nextInOrder, received[nextInOrder].value());
+                nextInOrder++;
+            }
+        }
+    }
+    pool.waitForDone();
+
+    QList<Result> results;
+    results.reserve(count);
+    for (std::optional<Result>& result : received)
+        results.append(std::move(result.value()));
+    return results;
+}
+
+}; // namespace Draupnir::Files
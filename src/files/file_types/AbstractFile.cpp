@@ -24,18 +24,42 @@
 
 #include "draupnir/files/file_types/AbstractFile.h"
 
+#include "draupnir/files/core/ContentHasher.h"
+#include "draupnir/files/core/FileWatcherService.h"
+
 #include <QDebug>
 
+#include <limits>
+
 namespace Draupnir::Files
 {
 
+namespace {
+
+/*! @brief Size type of QByteArray: `int` with Qt 5, `qsizetype` with Qt 6. */
+using ByteArraySize = decltype(QByteArray{}.size());
+
+/*! @brief Largest amount of bytes a single QByteArray may refer to. */
+constexpr qint64 maximumByteArraySize = std::numeric_limits<ByteArraySize>::max();
+
+}; // namespace
+
 AbstractFile::AbstractFile(QObject* parent) :
     QObject{parent},
     m_hasUnsavedData{false},
-    m_currentFileInfo{QFileInfo{}}
+    m_currentFileInfo{QFileInfo{}},
+    p_mappedFile{nullptr},
+    m_loadingCancelled{false},
+    m_syncPolicy{FileSyncPolicy::Full}
+{}
+
+AbstractFile::~AbstractFile()
 {
-    connect(&m_filesystemWatcher,&QFileSystemWatcher::fileChanged,
-            this, &AbstractFile::_onFileChanged);
+    // There is no service to unregister from if QCoreApplication is already destroyed.
+    FileWatcherService* watcherService = FileWatcherService::instance();
+    if (!isUntitled() && watcherService)
+        watcherService->unwatch(m_currentFileInfo.absoluteFilePath(), this);
+    _releaseMappedFile();
 }
 
 std::expected<void,QString> AbstractFile::open(const QString& filePath)
@@ -45,26 +69,14 @@ std::expected<void,QString> AbstractFile::open(const QString& filePath)
 
 std::expected<void,QString> AbstractFile::open(const QFileInfo& fileInfo)
 {
-    if (!fileInfo.exists()) {
-        const QFileInfo dirInfo{fileInfo.absolutePath()};
-        const bool canCreateFile =
-            dirInfo.exists() &&
-            dirInfo.isDir() &&
-            dirInfo.isWritable()
-#ifdef Q_OS_UNIX
-            && dirInfo.isExecutable()
-#endif
-            ;
-        if (!canCreateFile) {
-            return std::unexpected{tr("Can not create file in directory: ")+dirInfo.absoluteFilePath()};
-        } else {
-            setCurrentFileInfo(fileInfo);
-            setUnsavedData(false);
-            return {};
-        }
-    } else {
-        return _fileDataLoaded(fileInfo);
-    }
+    m_loadingCancelled.store(false, std::memory_order_relaxed);
+
+    const auto result = readFile(fileInfo);
+    if (!result)
+        return result;
+
+    completeOpen(fileInfo);
+    return {};
 };
 
 std::expected<void,QString> AbstractFile::save()
@@ -80,29 +92,100 @@ std::expected<void,QString> AbstractFile::saveAs(const QString& filePath)
 
 std::expected<void,QString> AbstractFile::saveAs(const QFileInfo& fileInfo)
 {
-    QFile file(fileInfo.absoluteFilePath());
-    if (!file.open(QIODevice::WriteOnly | extraFlags()))
-        return std::unexpected(QObject::tr("Error opening file %1.\r\n%2").arg(fileInfo.absoluteFilePath()).arg(file.errorString()));
+    const SaveJob saveJob = prepareSave(fileInfo);
+    const auto result = saveJob();
+    if (!result)
+        return result;
+
+    completeSave(fileInfo);
+    return {};
+};
+
+std::expected<void,QString> AbstractFile::readFile(const QFileInfo& fileInfo)
+{
+    m_loadedContentHash.reset();
+    if (fileInfo.exists())
+        return _fileDataLoaded(fileInfo);
 
+    const QFileInfo dirInfo{fileInfo.absolutePath()};
+    const bool canCreateFile =
+        dirInfo.exists() &&
+        dirInfo.isDir() &&
+        dirInfo.isWritable()
+#ifdef Q_OS_UNIX
+        && dirInfo.isExecutable()
+#endif
+        ;
+    if (!canCreateFile)
+        return std::unexpected{tr("Can not create file in directory: ")+dirInfo.absoluteFilePath()};
+
+    return {};
+}
+
+void AbstractFile::completeOpen(const QFileInfo& fileInfo)
+{
+    if (m_loadedContentHash)
+        _rememberDiskState(fileInfo, m_loadedContentHash.value());
+    else
+        m_diskState.reset();
+    m_loadedContentHash.reset();
+
+    setCurrentFileInfo(fileInfo);
+    setUnsavedData(false);
+}
+
+AbstractFile::SaveJob AbstractFile::prepareSave(const QFileInfo& fileInfo)
+{
     const QByteArray data = currentData();
-    const qint64 bytesWritten = file.write(data);
+    m_savedContentHash = ContentHasher::hash(data);
 
-    if (bytesWritten != data.size()) {
-        return std::unexpected(QObject::tr("Error writing file %1.\r\n%2")
-                                   .arg(fileInfo.absoluteFilePath()).arg(file.errorString()));
+    // Nothing to write if the file on disk already has exactly this contents.
+    const bool isSameFile = fileInfo.absoluteFilePath() == m_currentFileInfo.absoluteFilePath();
+    if (isSameFile && m_diskState && m_diskState->contentHash == m_savedContentHash.value() &&
+            m_diskState->size == data.size() && _isDiskContentUnchanged(fileInfo.absoluteFilePath())) {
+        return []() { return std::expected<void,QString>{}; };
     }
 
-    if (!file.flush()) {
-        file.close();
-        return std::unexpected(QObject::tr("Error flushing file %1.\r\n%2")
-                                   .arg(fileInfo.absoluteFilePath()).arg(file.errorString()));
+    // Saved file replaces the mapped one, whose pages would otherwise stay alive until the next open.
+    if (p_mappedFile && QFileInfo{p_mappedFile->fileName()}.absoluteFilePath() == fileInfo.absoluteFilePath()) {
+        mappedDataAboutToBeReleased();
+        _releaseMappedFile();
     }
 
-    file.close();
+    return [filePath = fileInfo.absoluteFilePath(), data, flags = extraFlags(), syncPolicy = m_syncPolicy]() {
+        return AtomicFileWriter::write(filePath, data, flags, syncPolicy);
+    };
+}
+
+void AbstractFile::completeSave(const QFileInfo& fileInfo)
+{
+    if (m_savedContentHash)
+        _rememberDiskState(fileInfo, m_savedContentHash.value());
+    m_savedContentHash.reset();
+
     setCurrentFileInfo(fileInfo);
+    // File might not exist while it was set as current one.
+    if (FileWatcherService* watcherService = FileWatcherService::instance())
+        watcherService->watch(m_currentFileInfo.absoluteFilePath(), this);
     setUnsavedData(false);
-    return {};
-};
+}
+
+std::expected<void,QString> AbstractFile::dataProcessed(const QByteArray& bytes)
+{
+    if (const auto started = chunkedLoadStarted(bytes.size()); !started)
+        return started;
+
+    if (const auto processed = dataChunkProcessed(bytes); !processed)
+        return processed;
+
+    return finish();
+}
+
+std::expected<void,QString> AbstractFile::dataChunkProcessed(const QByteArray& chunk)
+{
+    Q_UNUSED(chunk);
+    return std::unexpected(QObject::tr("Chunked loading is not supported by this file type."));
+}
 
 void AbstractFile::setUnsavedData(bool state)
 {
@@ -118,39 +201,193 @@ void AbstractFile::setCurrentFileInfo(const QFileInfo& fileInfo)
     if (m_currentFileInfo == fileInfo)
         return;
 
-    if (!m_currentFileInfo.absoluteFilePath().isEmpty())
-        m_filesystemWatcher.removePath(m_currentFileInfo.absoluteFilePath());
-
+    FileWatcherService* watcherService = FileWatcherService::instance();
+    if (!isUntitled() && watcherService)
+        watcherService->unwatch(m_currentFileInfo.absoluteFilePath(), this);
     m_currentFileInfo = fileInfo;
-    m_filesystemWatcher.addPath(m_currentFileInfo.absoluteFilePath());
+    if (watcherService)
+        watcherService->watch(m_currentFileInfo.absoluteFilePath(), this);
     emit fileInfoChanged(m_currentFileInfo);
 }
 
 std::expected<void,QString> AbstractFile::_fileDataLoaded(const QFileInfo& fileInfo)
 {
-    QFile file{fileInfo.absoluteFilePath()};
-    if (!file.open(QIODevice::ReadOnly | extraFlags()))
-        return std::unexpected(file.errorString());
+    // Allocated on the heap, as mapped memory is valid only while the file stays open. No parent is set, as this may be
+    // executed on a worker thread.
+    QFile* file = new QFile{fileInfo.absoluteFilePath()};
+    if (!file->open(QIODevice::ReadOnly | extraFlags())) {
+        const QString error = file->errorString();
+        delete file;
+        return std::unexpected(error);
+    }
+
+    const qint64 fileSize = file->size();
+    // Chunks are bounded, so files larger than a QByteArray can be streamed; they can not be passed at once.
+    const qint64 chunkSize = qMin(loadChunkSize(), maximumByteArraySize);
+    if (chunkSize <= 0 && fileSize > maximumByteArraySize) {
+        delete file;
+        return std::unexpected(QObject::tr("File is too large to be loaded at once: %1 bytes.").arg(fileSize));
+    }
+
+    const uchar* mappedData = (isMemoryMappingEnabled() && fileSize > 0) ?
+        file->map(0, fileSize) :
+        nullptr;
 
-    const QByteArray bytes = file.readAll();
-    file.close();
+    ContentHasher hasher;
+    std::expected<void,QString> result;
+    if (mappedData) {
+        const char* data = reinterpret_cast<const char*>(mappedData);
+        result = (chunkSize > 0) ?
+            _mappedDataStreamed(data, fileSize, chunkSize) :
+            dataProcessed(QByteArray::fromRawData(data, static_cast<ByteArraySize>(fileSize)));
+    } else {
+        if (chunkSize > 0) {
+            result = _fileDataStreamed(*file, chunkSize, hasher);
+        } else {
+            const QByteArray bytes = file->readAll();
+            hasher.addData(bytes);
+            result = dataProcessed(bytes);
+        }
+    }
+
+    if (!result || !mappedData)
+        delete file;
 
-    const auto result = dataProcessed(bytes);
     if (!result)
         return result;
 
-    setCurrentFileInfo(fileInfo);
-    setUnsavedData(false);
+    // Derived class has replaced its data, so the previous mapping is not referenced anymore.
+    _releaseMappedFile();
+    if (mappedData)
+        p_mappedFile = file;
+    else
+        m_loadedContentHash = hasher.result();
+
     return result;
 }
 
+std::expected<void,QString> AbstractFile::_fileDataStreamed(QFile& file, qint64 chunkSize, ContentHasher& hasher)
+{
+    if (const auto started = chunkedLoadStarted(file.size()); !started)
+        return started;
+
+    const qint64 totalSize = file.size();
+    qint64 bytesProcessed = 0;
+    QByteArray buffer{static_cast<ByteArraySize>(chunkSize), Qt::Uninitialized};
+    while (!file.atEnd()) {
+        if (const auto notCancelled = _checkCancelled(); !notCancelled)
+            return notCancelled;
+
+        const qint64 bytesRead = file.read(buffer.data(), chunkSize);
+        if (bytesRead < 0)
+            return std::unexpected(file.errorString());
+        if (bytesRead == 0)
+            break;
+
+        hasher.addData(buffer.constData(), bytesRead);
+        // Chunk shares the buffer, so nothing is copied per read.
+        const auto result = dataChunkProcessed(QByteArray::fromRawData(buffer.constData(), static_cast<ByteArraySize>(bytesRead)));
+        if (!result)
+            return result;
+
+        bytesProcessed += bytesRead;
+        emit loadProgressChanged(bytesProcessed, totalSize);
+    }
+
+    return finish();
+}
+
+std::expected<void,QString> AbstractFile::_mappedDataStreamed(const char* data, qint64 size, qint64 chunkSize)
+{
+    if (const auto started = chunkedLoadStarted(size); !started)
+        return started;
+
+    for (qint64 offset = 0; offset < size; offset += chunkSize) {
+        if (const auto notCancelled = _checkCancelled(); !notCancelled)
+            return notCancelled;
+
+        const qint64 length = qMin(chunkSize, size - offset);
+        const auto result = dataChunkProcessed(QByteArray::fromRawData(data + offset, static_cast<ByteArraySize>(length)));
+        if (!result)
+            return result;
+
+        emit loadProgressChanged(offset + length, size);
+    }
+
+    return finish();
+}
+
+std::expected<void,QString> AbstractFile::_checkCancelled() const
+{
+    if (m_loadingCancelled.load(std::memory_order_relaxed))
+        return std::unexpected(QObject::tr("Loading was cancelled."));
+
+    return {};
+}
+
+void AbstractFile::_releaseMappedFile()
+{
+    if (p_mappedFile == nullptr)
+        return;
+
+    // Closing the file unmaps all of its mapped regions.
+    delete p_mappedFile;
+    p_mappedFile = nullptr;
+}
+
+void AbstractFile::_rememberDiskState(const QFileInfo& fileInfo, quint64 contentHash)
+{
+    const QFileInfo diskInfo{fileInfo.absoluteFilePath()};
+    m_diskState = DiskState{contentHash, diskInfo.size()};
+}
+
+bool AbstractFile::_isDiskContentUnchanged(const QString& filePath) const
+{
+    // Fresh object, as a cached one may have outdated values. Modification time is not compared: an external rewrite of
+    // the same length within one timestamp tick would go unnoticed, so equal sizes are always verified by hashing.
+    const QFileInfo diskInfo{filePath};
+    if (!m_diskState || !diskInfo.exists() || diskInfo.size() != m_diskState->size)
+        return false;
+
+    const std::optional<quint64> diskHash = _diskContentHash(filePath);
+    return diskHash && diskHash.value() == m_diskState->contentHash;
+}
+
+std::optional<quint64> AbstractFile::_diskContentHash(const QString& filePath) const
+{
+    QFile file{filePath};
+    if (!file.open(QIODevice::ReadOnly | extraFlags()))
+        return std::nullopt;
+
+    static constexpr qint64 bufferSize = 64 * 1024;
+    QByteArray buffer{static_cast<int>(bufferSize), Qt::Uninitialized};
+    ContentHasher hasher;
+    for (;;) {
+        const qint64 bytesRead = file.read(buffer.data(), bufferSize);
+        if (bytesRead < 0)
+            return std::nullopt;
+        if (bytesRead == 0)
+            break;
+        hasher.addData(buffer.constData(), bytesRead);
+    }
+    return hasher.result();
+}
+
 void AbstractFile::_onFileChanged(const QString& filePath)
 {
     if (!QFile::exists(filePath)) {
+        m_diskState.reset();
         emit fileRemovedFromDisk();
-    } else {
-        emit fileChangedOnDisk();
+        return;
     }
+
+    // Our own saves, a `touch`, rewriting the same data and repeated events for the same change end here.
+    if (_isDiskContentUnchanged(filePath))
+        return;
+
+    // Contents on disk are no longer the ones this object knows.
+    m_diskState.reset();
+    emit fileChangedOnDisk();
 }
 
 }; // namespace Draupnir::Files
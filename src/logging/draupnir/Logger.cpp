@@ -25,6 +25,7 @@
 #include "draupnir/logging/Logger.h"
 
 #ifndef DRAUPNIR_LOGGING_SINGLETHREAD
+    #include <QHash>
     #include <QMutexLocker>
 #endif // DRAUPNIR_LOGGING_SINGLETHREAD
 
@@ -32,6 +33,44 @@
 
 namespace Draupnir::Logging {
 
+#ifndef DRAUPNIR_LOGGING_SINGLETHREAD
+namespace {
+
+/*! @brief Buffers of the message groups started by the current thread. Appending to these does not require locking the
+ *         logger. Group identifiers are unique within the process, so one cache serves all @ref Logger instances.
+ * @note Groups ended from other threads stay in the cache as closed buffers. They are swept from time to time when new
+ *       groups are registered. */
+class ThreadGroupBufferCache
+{
+public:
+    void insert(MessageGroup group, const QSharedPointer<MessageGroupBuffer>& buffer) {
+        if (m_buffers.size() >= m_sweepThreshold) {
+            for (auto it = m_buffers.begin(); it != m_buffers.end();)
+                it = it.value()->isClosed() ? m_buffers.erase(it) : std::next(it);
+            m_sweepThreshold = qMax(minimalSweepThreshold, 2 * m_buffers.size());
+        }
+        m_buffers.insert(group, buffer);
+    }
+
+    MessageGroupBuffer* find(MessageGroup group) const {
+        const auto it = m_buffers.constFind(group);
+        return (it == m_buffers.constEnd()) ? nullptr : it.value().data();
+    }
+
+    void remove(MessageGroup group) { m_buffers.remove(group); }
+
+private:
+    static constexpr int minimalSweepThreshold = 64;
+
+    QHash<MessageGroup,QSharedPointer<MessageGroupBuffer>> m_buffers;
+    int m_sweepThreshold = minimalSweepThreshold;
+};
+
+thread_local ThreadGroupBufferCache threadGroupBuffers;
+
+}; // namespace
+#endif // DRAUPNIR_LOGGING_SINGLETHREAD
+
 Logger::~Logger()
 {
     if (p_messageHandler == nullptr)
@@ -43,8 +82,9 @@ Logger::~Logger()
         p_tempMessageStorage = nullptr;
     }
 
-    for (const auto& messageList : m_messageGroupsMap)
-        qDeleteAll(messageList);
+    // Buffers may still be referenced by thread-local caches, so close them explicitly instead of relying on their destructors.
+    for (const auto& buffer : m_messageGroupsMap)
+        qDeleteAll(MessageGroupBuffer::toMessageList(buffer->closeChain()));
 
     m_messageGroupsMap.clear();
 }
@@ -80,9 +120,17 @@ void Logger::setMessageHandler(Draupnir::Logging::AbstractMessageHandler* handle
 
 Draupnir::Logging::MessageGroup Logger::beginMessageGroup()
 {
-    return _synchronized([&](){
-        return _beginMessageGroupUnsafe();
+    QSharedPointer<MessageGroupBuffer> buffer;
+
+    const MessageGroup group = _synchronized([&](){
+        return _beginMessageGroupUnsafe(buffer);
     });
+
+#ifndef DRAUPNIR_LOGGING_SINGLETHREAD
+    threadGroupBuffers.insert(group, buffer);
+#endif // DRAUPNIR_LOGGING_SINGLETHREAD
+
+    return group;
 }
 
 bool Logger::isGroupExisting(Draupnir::Logging::MessageGroup group) const
@@ -94,26 +142,26 @@ bool Logger::isGroupExisting(Draupnir::Logging::MessageGroup group) const
 
 void Logger::flush(Draupnir::Logging::MessageGroup group)
 {
-    MessageList messagesToDeliver;
-
-    const bool shouldDeliver = _synchronized([&] {
-        return _takeGroupMessagesForDeliveryUnsafe(group, false, messagesToDeliver);
+    Message* const chain = _synchronized([&] {
+        return _takeGroupMessagesForDeliveryUnsafe(group, false);
     });
 
-    if (shouldDeliver)
-        _deliverMessageListUnsafe(messagesToDeliver);
+    if (chain != nullptr)
+        _deliverMessageListUnsafe(MessageGroupBuffer::toMessageList(chain));
 }
 
 void Logger::endMessageGroup(Draupnir::Logging::MessageGroup group)
 {
-    MessageList messagesToDeliver;
-
-    const bool shouldDeliver = _synchronized([&] {
-        return _takeGroupMessagesForDeliveryUnsafe(group, true, messagesToDeliver);
+    Message* const chain = _synchronized([&] {
+        return _takeGroupMessagesForDeliveryUnsafe(group, true);
     });
 
-    if (shouldDeliver)
-        _deliverMessageListUnsafe(messagesToDeliver);
+#ifndef DRAUPNIR_LOGGING_SINGLETHREAD
+    threadGroupBuffers.remove(group);
+#endif // DRAUPNIR_LOGGING_SINGLETHREAD
+
+    if (chain != nullptr)
+        _deliverMessageListUnsafe(MessageGroupBuffer::toMessageList(chain));
 }
 
 void Logger::logMessage(Draupnir::Logging::Message* message)
@@ -137,16 +185,21 @@ void Logger::logMessage(Draupnir::Logging::Message* message, Draupnir::Logging::
 {
     Q_ASSERT(message);
 
-    const bool accepted = _synchronized([&] {
-        auto it = m_messageGroupsMap.find(group);
-
-        if (it == m_messageGroupsMap.end())
-            return false;
+#ifndef DRAUPNIR_LOGGING_SINGLETHREAD
+    // Fast path: the group was started by this thread, so its buffer is known without locking m_resourceMutex. If the buffer
+    // is already closed, the group was ended elsewhere and the synchronized path below will report it.
+    if (MessageGroupBuffer* localBuffer = threadGroupBuffers.find(group)) {
+        if (localBuffer->append(message))
+            return;
+    }
+#endif // DRAUPNIR_LOGGING_SINGLETHREAD
 
-        it.value().append(message);
-        return true;
+    const QSharedPointer<MessageGroupBuffer> buffer = _synchronized([&] {
+        return m_messageGroupsMap.value(group);
     });
 
+    const bool accepted = !buffer.isNull() && buffer->append(message);
+
     if (!accepted) {
         qDebug() << "Logger::logMessage() - non-existing message group.";
         delete message;
@@ -167,38 +220,41 @@ Logger::Logger() :
 #endif // DRAUPNIR_LOGGING_SINGLETHREAD
 }
 
-MessageGroup Logger::_beginMessageGroupUnsafe()
+MessageGroup Logger::_beginMessageGroupUnsafe(QSharedPointer<MessageGroupBuffer>& buffer)
 {
     const auto newGroup = MessageGroup::generateUniqueGroup();
 
     if (m_messageGroupsMap.contains(newGroup)) {
-        return Logger::_beginMessageGroupUnsafe();
+        return Logger::_beginMessageGroupUnsafe(buffer);
     }
 
-    m_messageGroupsMap.insert(newGroup, QList<Message*>{});
+    buffer = QSharedPointer<MessageGroupBuffer>::create();
+    m_messageGroupsMap.insert(newGroup, buffer);
     return newGroup;
 }
 
-bool Logger::_takeGroupMessagesForDeliveryUnsafe(MessageGroup group, bool removeGroup, MessageList& out)
+Message* Logger::_takeGroupMessagesForDeliveryUnsafe(MessageGroup group, bool removeGroup)
 {
     auto it = m_messageGroupsMap.find(group);
 
     if (it == m_messageGroupsMap.end()) {
         qDebug() << "Logger - non-existing message group.";
-        return false;
+        return nullptr;
     }
 
-    if (p_messageHandler != nullptr) {
-        out.swap(it.value());
-    } else {
-        Q_ASSERT(p_tempMessageStorage);
-        p_tempMessageStorage->append(it.value());
-        it.value().clear();
-    }
+    // Closing the buffer before the group is removed from the map guarantees that a concurrent lock-free append either lands
+    // in the detached chain or fails and is reported as logging into a non-existing group.
+    Message* chain = removeGroup ? it.value()->closeChain() : it.value()->takeChain();
 
     if (removeGroup) m_messageGroupsMap.erase(it);
 
-    return !out.isEmpty();
+    if (p_messageHandler == nullptr && chain != nullptr) {
+        Q_ASSERT(p_tempMessageStorage);
+        p_tempMessageStorage->append(MessageGroupBuffer::toMessageList(chain));
+        return nullptr;
+    }
+
+    return chain;
 }
 
 void Logger::_deliverMessageUnsafe(Message* message)
@@ -0,0 +1,350 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "draupnir/logging/core/MessageStream.h"
+
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QVector>
+
+namespace Draupnir::Logging
+{
+
+namespace {
+
+/*! @brief Magic number starting files in @ref MessageStreamFormat::Binary format ("DRLG"). */
+constexpr quint32 binaryMagic = 0x44524C47;
+
+/*! @brief Current version of the @ref MessageStreamFormat::Binary format. */
+constexpr quint16 binaryVersion = 1;
+
+/*! @brief Returns `true` if `level` is one of the known @ref MessageLevel::Value values. */
+bool isValidLevel(int level)
+{
+    return level == MessageLevel::Debug || level == MessageLevel::Info ||
+           level == MessageLevel::Warning || level == MessageLevel::Error;
+}
+
+/*! @brief Returns category with provided name (interning it if needed) or with provided id if name is empty. */
+MessageCategory restoreCategory(const QByteArray& name, quint32 id)
+{
+    if (name.isEmpty())
+        return MessageCategory{id};
+    return MessageCategory::intern(std::string_view{name.constData(), static_cast<size_t>(name.size())});
+}
+
+/*! @brief Field read from a stream. String values are kept in `string` until they are moved into the message storage. */
+struct PendingField
+{
+    MessageFieldKey key;
+    MessageFieldValue value;
+    QByteArray string;
+};
+
+/*! @brief Creates message owning string values of the provided fields. */
+Message* restoreMessage(MessageType type, QString brief, QString what, const QDateTime& dateTime, const QVector<PendingField>& pendingFields)
+{
+    int storageSize = 0;
+    for (const PendingField& field : pendingFields)
+        storageSize += (field.value.type() == MessageFieldValue::String) ? field.string.size() : 0;
+
+    QByteArray storage;
+    storage.reserve(storageSize);
+    for (const PendingField& field : pendingFields) {
+        if (field.value.type() == MessageFieldValue::String)
+            storage.append(field.string);
+    }
+
+    MessageFields fields;
+    int offset = 0;
+    for (const PendingField& field : pendingFields) {
+        if (field.value.type() != MessageFieldValue::String) {
+            fields.append(field.key, field.value);
+            continue;
+        }
+        fields.append(field.key, std::string_view{storage.constData() + offset, static_cast<size_t>(field.string.size())});
+        offset += field.string.size();
+    }
+
+    return Message::restore(type, std::move(brief), std::move(what), dateTime, std::move(fields), std::move(storage));
+}
+
+QByteArray toByteArray(std::string_view view)
+{
+    return QByteArray{view.data(), static_cast<int>(view.size())};
+}
+
+}; // namespace
+
+MessageStreamWriter::MessageStreamWriter(QIODevice* device, MessageStreamFormat format) :
+    p_device{device},
+    m_dataStream{device},
+    m_format{format},
+    m_headerWritten{false}
+{
+    Q_ASSERT_X(device, "MessageStreamWriter::MessageStreamWriter", "Provided QIODevice* is nullptr.");
+    m_dataStream.setVersion(QDataStream::Qt_5_15);
+}
+
+std::expected<void,QString> MessageStreamWriter::write(const Message& message)
+{
+    switch (m_format) {
+    case MessageStreamFormat::JsonLines: return _writeJsonLine(message);
+    case MessageStreamFormat::Binary:    return _writeBinaryRecord(message);
+    }
+    Q_UNREACHABLE();
+    return {};
+}
+
+std::expected<void,QString> MessageStreamWriter::_writeJsonLine(const Message& message)
+{
+    QJsonObject record;
+    record.insert("t", message.dateTime().toMSecsSinceEpoch());
+    record.insert("l", static_cast<int>(message.type().level()));
+
+    const MessageCategory category = message.type().category();
+    const QLatin1String categoryName = category.name();
+    if (categoryName.isEmpty())
+        record.insert("c", static_cast<qint64>(category.value()));
+    else
+        record.insert("c", QString{categoryName});
+
+    if (!message.brief().isEmpty())
+        record.insert("b", message.brief());
+    record.insert("w", message.what());
+
+    if (!message.fields().isEmpty()) {
+        QJsonArray fields;
+        for (const MessageField& field : message.fields()) {
+            QJsonObject fieldObject;
+            fieldObject.insert("k", QString{field.key.name()});
+            switch (field.value.type()) {
+            // 64-bit integers are stored as strings, as JSON numbers are not able to represent them precisely
+            case MessageFieldValue::Int64:  fieldObject.insert("i", QString::number(field.value.toInt64())); break;
+            case MessageFieldValue::Double: fieldObject.insert("d", field.value.toDouble()); break;
+            case MessageFieldValue::Bool:   fieldObject.insert("b", field.value.toBool()); break;
+            case MessageFieldValue::String: fieldObject.insert("s", field.value.toString()); break;
+            }
+            fields.append(fieldObject);
+        }
+        record.insert("f", fields);
+    }
+
+    QByteArray line = QJsonDocument{record}.toJson(QJsonDocument::Compact);
+    line.append('\n');
+    if (p_device->write(line) != line.size())
+        return std::unexpected{p_device->errorString()};
+
+    return {};
+}
+
+std::expected<void,QString> MessageStreamWriter::_writeBinaryRecord(const Message& message)
+{
+    if (!m_headerWritten) {
+        m_dataStream << binaryMagic << binaryVersion;
+        m_headerWritten = true;
+    }
+
+    const MessageCategory category = message.type().category();
+    const QLatin1String categoryName = category.name();
+
+    m_dataStream << message.dateTime().toMSecsSinceEpoch()
+                 << static_cast<quint8>(message.type().level())
+                 << QByteArray{categoryName.data(), categoryName.size()}
+                 << category.value()
+                 << message.brief()
+                 << message.what()
+                 << static_cast<quint16>(message.fields().count());
+
+    for (const MessageField& field : message.fields()) {
+        const QLatin1String keyName = field.key.name();
+        m_dataStream << QByteArray{keyName.data(), keyName.size()} << static_cast<quint8>(field.value.type());
+        switch (field.value.type()) {
+        case MessageFieldValue::Int64:  m_dataStream << field.value.toInt64(); break;
+        case MessageFieldValue::Double: m_dataStream << field.value.toDouble(); break;
+        case MessageFieldValue::Bool:   m_dataStream << field.value.toBool(); break;
+        case MessageFieldValue::String: m_dataStream << toByteArray(field.value.toStringView()); break;
+        }
+    }
+
+    if (m_dataStream.status() != QDataStream::Ok)
+        return std::unexpected{p_device->errorString()};
+
+    return {};
+}
+
+MessageStreamReader::MessageStreamReader(QIODevice* device, MessageStreamFormat format) :
+    p_device{device},
+    m_dataStream{device},
+    m_format{format},
+    m_headerRead{false}
+{
+    Q_ASSERT_X(device, "MessageStreamReader::MessageStreamReader", "Provided QIODevice* is nullptr.");
+    m_dataStream.setVersion(QDataStream::Qt_5_15);
+}
+
+std::expected<MessageList,QString> MessageStreamReader::readChunk(int maxCount)
+{
+    MessageList result;
+    while (result.count() < maxCount && !atEnd()) {
+        const std::expected<Message*,QString> message = (m_format == MessageStreamFormat::JsonLines) ?
+            _readJsonLine() :
+            _readBinaryRecord();
+
+        if (!message) {
+            qDeleteAll(result);
+            return std::unexpected{message.error()};
+        }
+        if (message.value() != nullptr)
+            result.append(message.value());
+    }
+    return result;
+}
+
+bool MessageStreamReader::atEnd() const
+{
+    return p_device->atEnd();
+}
+
+std::expected<Message*,QString> MessageStreamReader::_readJsonLine()
+{
+    const QByteArray line = p_device->readLine().trimmed();
+    if (line.isEmpty())
+        return nullptr;
+
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(line, &parseError);
+    if (parseError.error != QJsonParseError::NoError)
+        return std::unexpected{parseError.errorString()};
+    if (!document.isObject())
+        return std::unexpected{QObject::tr("Message record is not a JSON object.")};
+
+    const QJsonObject record = document.object();
+
+    const int level = record.value("l").toInt();
+    if (!isValidLevel(level))
+        return std::unexpected{QObject::tr("Unknown message level %1.").arg(level)};
+
+    const QJsonValue categoryValue = record.value("c");
+    const MessageCategory category = categoryValue.isString() ?
+        restoreCategory(categoryValue.toString().toLatin1(), 0) :
+        MessageCategory{static_cast<quint32>(categoryValue.toDouble(MessageCategory::Default))};
+
+    QVector<PendingField> fields;
+    const QJsonArray fieldsArray = record.value("f").toArray();
+    fields.reserve(fieldsArray.size());
+    for (const QJsonValue& fieldValue : fieldsArray) {
+        const QJsonObject fieldObject = fieldValue.toObject();
+        const QByteArray keyName = fieldObject.value("k").toString().toUtf8();
+        if (keyName.isEmpty())
+            return std::unexpected{QObject::tr("Message field without a name.")};
+
+        PendingField field{MessageFieldKey::intern(std::string_view{keyName.constData(), static_cast<size_t>(keyName.size())}), {}, {}};
+        if (fieldObject.contains("i")) {
+            field.value = fieldObject.value("i").toString().toLongLong();
+        } else if (fieldObject.contains("d")) {
+            field.value = fieldObject.value("d").toDouble();
+        } else if (fieldObject.contains("b")) {
+            field.value = fieldObject.value("b").toBool();
+        } else if (fieldObject.contains("s")) {
+            field.string = fieldObject.value("s").toString().toUtf8();
+            field.value = MessageFieldValue{std::string_view{}};
+        } else {
+            return std::unexpected{QObject::tr("Message field %1 has no value.").arg(QString::fromUtf8(keyName))};
+        }
+        fields.append(field);
+    }
+
+    return restoreMessage(
+        MessageType{static_cast<MessageLevel::Value>(level), category},
+        record.value("b").toString(),
+        record.value("w").toString(),
+        QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(record.value("t").toDouble())),
+        fields
+    );
+}
+
+std::expected<Message*,QString> MessageStreamReader::_readBinaryRecord()
+{
+    if (!m_headerRead) {
+        quint32 magic = 0;
+        quint16 version = 0;
+        m_dataStream >> magic >> version;
+        if (m_dataStream.status() != QDataStream::Ok || magic != binaryMagic)
+            return std::unexpected{QObject::tr("Not a message stream.")};
+        if (version > binaryVersion)
+            return std::unexpected{QObject::tr("Unsupported message stream version %1.").arg(version)};
+        m_headerRead = true;
+        if (atEnd())
+            return nullptr;
+    }
+
+    qint64 msecsSinceEpoch = 0;
+    quint8 level = 0;
+    QByteArray categoryName;
+    quint32 categoryId = 0;
+    QString brief;
+    QString what;
+    quint16 fieldCount = 0;
+    m_dataStream >> msecsSinceEpoch >> level >> categoryName >> categoryId >> brief >> what >> fieldCount;
+
+    QVector<PendingField> fields;
+    fields.reserve(fieldCount);
+    for (quint16 i = 0; i < fieldCount && m_dataStream.status() == QDataStream::Ok; i++) {
+        QByteArray keyName;
+        quint8 type = 0;
+        m_dataStream >> keyName >> type;
+        if (keyName.isEmpty())
+            return std::unexpected{QObject::tr("Message field without a name.")};
+
+        PendingField field{MessageFieldKey::intern(std::string_view{keyName.constData(), static_cast<size_t>(keyName.size())}), {}, {}};
+        switch (type) {
+        case MessageFieldValue::Int64:  { qint64 value = 0; m_dataStream >> value; field.value = value; break; }
+        case MessageFieldValue::Double: { double value = 0; m_dataStream >> value; field.value = value; break; }
+        case MessageFieldValue::Bool:   { bool value = false; m_dataStream >> value; field.value = value; break; }
+        case MessageFieldValue::String: { m_dataStream >> field.string; field.value = MessageFieldValue{std::string_view{}}; break; }
+        default:
+            return std::unexpected{QObject::tr("Unknown message field type %1.").arg(type)};
+        }
+        fields.append(field);
+    }
+
+    if (m_dataStream.status() != QDataStream::Ok)
+        return std::unexpected{QObject::tr("Message stream is truncated or corrupted.")};
+    if (!isValidLevel(level))
+        return std::unexpected{QObject::tr("Unknown message level %1.").arg(level)};
+
+    return restoreMessage(
+        MessageType{static_cast<MessageLevel::Value>(level), restoreCategory(categoryName, categoryId)},
+        std::move(brief),
+        std::move(what),
+        QDateTime::fromMSecsSinceEpoch(msecsSinceEpoch),
+        fields
+    );
+}
+
+}; // namespace Draupnir::Logging
@@ -0,0 +1,130 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "draupnir/logging/messages/MessageCategories.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <deque>
+
+namespace Draupnir::Logging
+{
+
+namespace {
+
+/*! @brief Process-wide storage of message category names. Names are kept in a `std::deque` so that views returned by
+ *         @ref MessageCategory::name stay valid while new categories are registered. */
+struct MessageCategoryRegistry
+{
+    QMutex mutex;
+    QHash<QByteArray,quint32> idByName;
+    QHash<quint32,const QByteArray*> nameById;
+    std::deque<QByteArray> names;
+    quint32 lastInternedId = MessageCategory::FirstInternedCategory - 1;
+
+    MessageCategoryRegistry() {
+        _insert(MessageCategory::Default, QByteArrayLiteral("default"));
+    }
+
+    static MessageCategoryRegistry& get() {
+        static MessageCategoryRegistry theOne;
+        return theOne;
+    }
+
+    void _insert(quint32 id, const QByteArray& name) {
+        names.push_back(name);
+        idByName.insert(name, id);
+        nameById.insert(id, &names.back());
+    }
+};
+
+}; // namespace
+
+MessageCategory MessageCategory::intern(std::string_view name)
+{
+    Q_ASSERT_X(!name.empty(), "MessageCategory::intern", "Category name must not be empty.");
+
+    auto& registry = MessageCategoryRegistry::get();
+    const QByteArray rawName{name.data(), static_cast<int>(name.size())};
+
+    QMutexLocker locker{&registry.mutex};
+    const auto it = registry.idByName.constFind(rawName);
+    if (it != registry.idByName.constEnd())
+        return MessageCategory{it.value()};
+
+    const quint32 id = ++registry.lastInternedId;
+    registry._insert(id, rawName);
+    return MessageCategory{id};
+}
+
+bool MessageCategory::registerName(MessageCategory category, std::string_view name)
+{
+    Q_ASSERT_X(category, "MessageCategory::registerName", "Provided MessageCategory is invalid.");
+    Q_ASSERT_X(!name.empty(), "MessageCategory::registerName", "Category name must not be empty.");
+
+    auto& registry = MessageCategoryRegistry::get();
+    const QByteArray rawName{name.data(), static_cast<int>(name.size())};
+
+    QMutexLocker locker{&registry.mutex};
+    const auto it = registry.idByName.constFind(rawName);
+    if (it != registry.idByName.constEnd())
+        return it.value() == category.value();
+
+    if (category.value() >= MessageCategory::FirstInternedCategory || registry.nameById.contains(category.value()))
+        return false;
+
+    registry._insert(category.value(), rawName);
+    return true;
+}
+
+std::optional<MessageCategory> MessageCategory::find(std::string_view name)
+{
+    auto& registry = MessageCategoryRegistry::get();
+    const QByteArray rawName = QByteArray::fromRawData(name.data(), static_cast<int>(name.size()));
+
+    QMutexLocker locker{&registry.mutex};
+    const auto it = registry.idByName.constFind(rawName);
+    if (it == registry.idByName.constEnd())
+        return std::nullopt;
+
+    return MessageCategory{it.value()};
+}
+
+QLatin1String MessageCategory::name() const
+{
+    auto& registry = MessageCategoryRegistry::get();
+
+    QMutexLocker locker{&registry.mutex};
+    const QByteArray* rawName = registry.nameById.value(m_value, nullptr);
+    if (rawName == nullptr)
+        return QLatin1String{};
+
+    return QLatin1String{rawName->constData(), rawName->size()};
+}
+
+}; // namespace Draupnir::Logging
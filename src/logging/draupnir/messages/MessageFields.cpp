@@ -0,0 +1,122 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "draupnir/logging/messages/MessageFields.h"
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+#include <deque>
+
+namespace Draupnir::Logging
+{
+
+namespace {
+
+/*! @brief Process-wide storage of interned field names. Names are kept in a `std::deque` so that views returned by
+ *         @ref MessageFieldKey::name stay valid while new names are registered. */
+struct MessageFieldKeyRegistry
+{
+    QMutex mutex;
+    QHash<QByteArray,quint32> idByName;
+    std::deque<QByteArray> names;
+
+    static MessageFieldKeyRegistry& get() {
+        static MessageFieldKeyRegistry theOne;
+        return theOne;
+    }
+};
+
+}; // namespace
+
+MessageFieldKey MessageFieldKey::intern(std::string_view name)
+{
+    Q_ASSERT_X(!name.empty(), "MessageFieldKey::intern", "Field name must not be empty.");
+
+    auto& registry = MessageFieldKeyRegistry::get();
+    const QByteArray rawName{name.data(), static_cast<int>(name.size())};
+
+    QMutexLocker locker{&registry.mutex};
+    const auto it = registry.idByName.constFind(rawName);
+    if (it != registry.idByName.constEnd())
+        return MessageFieldKey{it.value()};
+
+    registry.names.push_back(rawName);
+    const quint32 id = static_cast<quint32>(registry.names.size());
+    registry.idByName.insert(rawName, id);
+    return MessageFieldKey{id};
+}
+
+std::optional<MessageFieldKey> MessageFieldKey::find(std::string_view name)
+{
+    auto& registry = MessageFieldKeyRegistry::get();
+    const QByteArray rawName = QByteArray::fromRawData(name.data(), static_cast<int>(name.size()));
+
+    QMutexLocker locker{&registry.mutex};
+    const auto it = registry.idByName.constFind(rawName);
+    if (it == registry.idByName.constEnd())
+        return std::nullopt;
+
+    return MessageFieldKey{it.value()};
+}
+
+QLatin1String MessageFieldKey::name() const
+{
+    auto& registry = MessageFieldKeyRegistry::get();
+
+    QMutexLocker locker{&registry.mutex};
+    if (m_value == 0 || m_value > registry.names.size())
+        return QLatin1String{};
+
+    const QByteArray& rawName = registry.names[m_value - 1];
+    return QLatin1String{rawName.constData(), rawName.size()};
+}
+
+QByteArray MessageFields::copyStrings()
+{
+    int storageSize = 0;
+    for (const MessageField& field : std::as_const(*this))
+        storageSize += static_cast<int>(field.value.toStringView().size());
+    if (storageSize == 0)
+        return QByteArray{};
+
+    // Reserved up front, so views into the buffer stay valid while it is filled.
+    QByteArray storage;
+    storage.reserve(storageSize);
+    for (MessageField& field : *this) {
+        if (field.value.type() != MessageFieldValue::String)
+            continue;
+
+        const std::string_view string = field.value.toStringView();
+        const int offset = storage.size();
+        storage.append(string.data(), static_cast<int>(string.size()));
+        field.value = std::string_view{storage.constData() + offset, string.size()};
+    }
+    return storage;
+}
+
+}; // namespace Draupnir::Logging
@@ -45,8 +45,12 @@ QString MessageViewItem::getViewString(const MessageViewItemFields& fields) cons
         m_cachedView.clear();
         if (fields & MessageViewItemField::Brief)
             m_cachedView += p_message->brief();
-        if (fields & MessageViewItemField::What)
+        if (fields & MessageViewItemField::What) {
             m_cachedView += (m_cachedView.isEmpty() ? "" : "\n") + p_message->what();
+            // Structured fields are rendered only here, when the view string is actually requested.
+            if (!p_message->fields().isEmpty())
+                m_cachedView += (m_cachedView.isEmpty() ? "" : "\n") + p_message->fields().toString();
+        }
         if (fields & MessageViewItemField::DateTime)
             m_cachedView += (m_cachedView.isEmpty() ? "" : "\n") + p_message->dateTime().toString();
     }
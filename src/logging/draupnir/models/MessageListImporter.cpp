@@ -0,0 +1,177 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "draupnir/logging/models/MessageListImporter.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QThread>
+
+#include "draupnir/logging/models/MessageListModel.h"
+
+namespace Draupnir::Logging
+{
+
+MessageListImporter::MessageListImporter(MessageListModel* model, QObject* parent) :
+    QObject{parent},
+    p_model{model},
+    m_chunkSize{1000},
+    p_workerThread{nullptr},
+    m_freeChunkSlots{maxQueuedChunks},
+    m_cancelRequested{false},
+    m_bytesTotal{0}
+{
+    Q_ASSERT_X(model, "MessageListImporter::MessageListImporter", "Provided MessageListModel* is nullptr.");
+}
+
+MessageListImporter::~MessageListImporter()
+{
+    if (p_workerThread) {
+        cancel();
+        p_workerThread->wait();
+        delete p_workerThread;
+    }
+    _discardReadyChunks();
+}
+
+void MessageListImporter::setChunkSize(int chunkSize)
+{
+    Q_ASSERT_X(chunkSize > 0, "MessageListImporter::setChunkSize", "Chunk size must be greater than zero.");
+    m_chunkSize = chunkSize;
+}
+
+bool MessageListImporter::start(const QString& fileName, MessageStreamFormat format)
+{
+    if (isRunning())
+        return false;
+
+    m_cancelRequested = false;
+    m_bytesTotal = QFileInfo{fileName}.size();
+
+    const int chunkSize = m_chunkSize;
+    p_workerThread = QThread::create([this, fileName, format, chunkSize]() {
+        _readFile(fileName, format, chunkSize);
+    });
+    p_workerThread->start();
+    return true;
+}
+
+void MessageListImporter::cancel()
+{
+    if (!isRunning())
+        return;
+
+    m_cancelRequested = true;
+    // Wake up the worker if it waits for a free slot
+    m_freeChunkSlots.release(maxQueuedChunks);
+}
+
+void MessageListImporter::_readFile(const QString& fileName, MessageStreamFormat format, int chunkSize)
+{
+    const auto reportFinished = [this](bool success, const QString& errorString) {
+        QMetaObject::invokeMethod(this, [this, success, errorString]() {
+            _onWorkerFinished(success, errorString);
+        }, Qt::QueuedConnection);
+    };
+
+    QFile file{fileName};
+    if (!file.open(QIODevice::ReadOnly)) {
+        reportFinished(false, QObject::tr("Error opening file %1.\r\n%2").arg(fileName, file.errorString()));
+        return;
+    }
+
+    MessageStreamReader reader{&file, format};
+    while (!reader.atEnd()) {
+        m_freeChunkSlots.acquire();
+        if (m_cancelRequested) {
+            reportFinished(false, QObject::tr("Import was cancelled."));
+            return;
+        }
+
+        std::expected<MessageList,QString> chunk = reader.readChunk(chunkSize);
+        if (!chunk) {
+            reportFinished(false, QObject::tr("Error reading file %1.\r\n%2").arg(fileName, chunk.error()));
+            return;
+        }
+
+        {
+            QMutexLocker locker{&m_readyChunksMutex};
+            m_readyChunks.enqueue(qMakePair(std::move(chunk.value()), file.pos()));
+        }
+        QMetaObject::invokeMethod(this, &MessageListImporter::_appendReadyChunks, Qt::QueuedConnection);
+    }
+
+    reportFinished(true, QString{});
+}
+
+void MessageListImporter::_appendReadyChunks()
+{
+    for (;;) {
+        QPair<MessageList,qint64> chunk;
+        {
+            QMutexLocker locker{&m_readyChunksMutex};
+            if (m_readyChunks.isEmpty())
+                return;
+            chunk = m_readyChunks.dequeue();
+        }
+        m_freeChunkSlots.release();
+
+        if (m_cancelRequested) {
+            qDeleteAll(chunk.first);
+            continue;
+        }
+
+        p_model->append(chunk.first);
+        emit progressChanged(chunk.second, m_bytesTotal);
+    }
+}
+
+void MessageListImporter::_onWorkerFinished(bool success, const QString& errorString)
+{
+    _appendReadyChunks();
+
+    p_workerThread->wait();
+    delete p_workerThread;
+    p_workerThread = nullptr;
+
+    // Restore slots released by cancel()
+    m_freeChunkSlots.acquire(m_freeChunkSlots.available());
+    m_freeChunkSlots.release(maxQueuedChunks);
+
+    if (m_cancelRequested)
+        emit finished(false, tr("Import was cancelled."));
+    else
+        emit finished(success, errorString);
+}
+
+void MessageListImporter::_discardReadyChunks()
+{
+    QMutexLocker locker{&m_readyChunksMutex};
+    while (!m_readyChunks.isEmpty())
+        qDeleteAll(m_readyChunks.dequeue().first);
+}
+
+}; // namespace Draupnir::Logging
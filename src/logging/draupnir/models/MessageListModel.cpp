@@ -24,6 +24,7 @@
 
 #include "draupnir/logging/models/MessageListModel.h"
 
+#include "draupnir/logging/core/MessageStream.h"
 #include "draupnir/logging/messages/MessageViewItem.h"
 
 namespace Draupnir::Logging
@@ -92,6 +93,16 @@ void MessageListModel::append(const QList<MessageViewItem*>& messages)
     endInsertRows();
 }
 
+std::expected<void,QString> MessageListModel::exportMessages(MessageStreamWriter& writer) const
+{
+    for (const MessageViewItem* item : m_data) {
+        const std::expected<void,QString> result = writer.write(*item->message());
+        if (!result)
+            return result;
+    }
+    return {};
+}
+
 void MessageListModel::clear()
 {
     beginResetModel();
@@ -79,6 +79,51 @@ void MessageListProxyModel::setMessageCategoryDisplayed(MessageCategory category
     invalidateFilter();
 }
 
+void MessageListProxyModel::setMessageFieldFilter(MessageFieldKey key, MessageFieldPredicate predicate)
+{
+    Q_ASSERT_X(key, "MessageListProxyModel::setMessageFieldFilter", "Provided MessageFieldKey is invalid.");
+    Q_ASSERT_X(predicate, "MessageListProxyModel::setMessageFieldFilter", "Provided predicate is empty.");
+
+    m_filteredMessageFieldKey = key;
+    m_messageFieldPredicate = std::move(predicate);
+    invalidateFilter();
+}
+
+void MessageListProxyModel::clearMessageFieldFilter()
+{
+    if (!hasMessageFieldFilter())
+        return;
+
+    m_filteredMessageFieldKey = MessageFieldKey{};
+    m_messageFieldPredicate = nullptr;
+    invalidateFilter();
+}
+
+MessageListProxyModel::MessageFieldAggregate MessageListProxyModel::aggregateMessageField(MessageFieldKey key) const
+{
+    MessageFieldAggregate result;
+
+    const int rows = rowCount();
+    for (int row = 0; row < rows; row++) {
+        const QModelIndex sourceIndex = mapToSource(index(row, 0));
+        const MessageViewItem* const message = static_cast<MessageViewItem*>(sourceIndex.internalPointer());
+        if (message == nullptr)
+            continue;
+
+        const MessageFieldValue* value = message->fields().value(key);
+        if (value == nullptr || !value->isNumeric())
+            continue;
+
+        const double number = value->toDouble();
+        result.min = (result.count == 0) ? number : qMin(result.min, number);
+        result.max = (result.count == 0) ? number : qMax(result.max, number);
+        result.sum += number;
+        result.count++;
+    }
+
+    return result;
+}
+
 void MessageListProxyModel::setDisplayedMessageLevelsMask(MessageLevels mask)
 {
     if (m_displayedMessageLevelsMask == mask)
@@ -131,7 +176,14 @@ bool MessageListProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &s
     Q_ASSERT_X(msgView, "MessageListProxyModel::filterAcceptsRow",
         "Source model for this proxy model MUST provide QModelIndex having internalPointer");
 
-    return isMessageTypeDisplayed(msgView->type());
+    if (!isMessageTypeDisplayed(msgView->type()))
+        return false;
+
+    if (!m_messageFieldPredicate)
+        return true;
+
+    const MessageFieldValue* value = msgView->fields().value(m_filteredMessageFieldKey);
+    return (value != nullptr) && m_messageFieldPredicate(*value);
 }
 
 }; // namespace Draupnir::Messages
@@ -50,6 +50,16 @@ AppSettings::~AppSettings()
     delete p_settings;
 }
 
+QString AppSettings::fileName() const
+{
+    return p_settings->fileName();
+}
+
+void AppSettings::sync()
+{
+    p_settings->sync();
+}
+
 bool AppSettings::contains(const QString& key) const
 {
     return p_settings->contains(key);
@@ -0,0 +1,476 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "draupnir/settings_registry/core/BinarySettingsBackend.h"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QSaveFile>
+#include <QVector>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draupnir/utils/static_perfect_hash.h"
+
+namespace Draupnir::Settings
+{
+
+namespace {
+
+/*! @brief Magic number starting binary settings files ("DRST"). */
+constexpr quint32 fileMagic = 0x54535244;
+
+/*! @brief Size of the file header in bytes. */
+constexpr qint64 headerSize = 16;
+
+/*! @brief Size of a single index entry in bytes. */
+constexpr qint64 entrySize = 32;
+
+/*! @brief Computes FNV-1a hash of the UTF-8 representation of `key` without converting it. Matches
+ *         @ref draupnir::utils::fnv1a_64 applied to `key.toUtf8()`. */
+quint64 keyHash(const QString& key)
+{
+    quint64 result = 0xcbf29ce484222325ull;
+    const auto feed = [&result](uint byte) {
+        result ^= byte;
+        result *= 0x100000001b3ull;
+    };
+
+    const QChar* data = key.constData();
+    const int size = key.size();
+    for (int i = 0; i < size; i++) {
+        uint codePoint = data[i].unicode();
+        if (data[i].isHighSurrogate() && i + 1 < size && data[i + 1].isLowSurrogate()) {
+            codePoint = QChar::surrogateToUcs4(data[i], data[i + 1]);
+            i++;
+        }
+
+        if (codePoint < 0x80) {
+            feed(codePoint);
+        } else if (codePoint < 0x800) {
+            feed(0xC0 | (codePoint >> 6));
+            feed(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            feed(0xE0 | (codePoint >> 12));
+            feed(0x80 | ((codePoint >> 6) & 0x3F));
+            feed(0x80 | (codePoint & 0x3F));
+        } else {
+            feed(0xF0 | (codePoint >> 18));
+            feed(0x80 | ((codePoint >> 12) & 0x3F));
+            feed(0x80 | ((codePoint >> 6) & 0x3F));
+            feed(0x80 | (codePoint & 0x3F));
+        }
+    }
+    return result;
+}
+
+/*! @brief Compares `key` with UTF-8 encoded key stored within the file. ASCII keys are compared without allocations. */
+bool keyEquals(const QString& key, const char* data, int size)
+{
+    const bool isAscii = std::none_of(data, data + size, [](char character) {
+        return static_cast<uchar>(character) >= 0x80;
+    });
+    if (isAscii)
+        return key == QLatin1String{data, size};
+    return key == QString::fromUtf8(data, size);
+}
+
+QByteArray encodeInt64(qint64 value)
+{
+    QByteArray result(sizeof(qint64), Qt::Uninitialized);
+    qToLittleEndian<qint64>(value, result.data());
+    return result;
+}
+
+QByteArray encodeDouble(double value)
+{
+    quint64 bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    QByteArray result(sizeof(quint64), Qt::Uninitialized);
+    qToLittleEndian<quint64>(bits, result.data());
+    return result;
+}
+
+double decodeDouble(const char* data)
+{
+    const quint64 bits = qFromLittleEndian<quint64>(data);
+    double result = 0;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/*! @brief Entry collected while writing the file. */
+struct PendingEntry {
+    quint64 hash;
+    QByteArray key;
+    quint8 type;
+    QByteArray value;
+};
+
+}; // namespace
+
+BinarySettingsBackend::BinarySettingsBackend(const QString& fileName) :
+    m_fileName{fileName},
+    p_mapped{nullptr},
+    m_mappedSize{0},
+    m_entryCount{0}
+{}
+
+BinarySettingsBackend::~BinarySettingsBackend()
+{
+    if (hasPendingChanges()) {
+        if (const auto committed = commit(); !committed)
+            qWarning() << "BinarySettingsBackend: failed to write" << m_fileName << ":" << committed.error();
+    }
+    _unmap();
+}
+
+std::expected<void,QString> BinarySettingsBackend::load()
+{
+    _unmap();
+
+    m_file.setFileName(m_fileName);
+    if (!m_file.exists())
+        return {};
+
+    if (!m_file.open(QIODevice::ReadOnly))
+        return std::unexpected{QString{"Can not open %1: %2"}.arg(m_fileName, m_file.errorString())};
+
+    const qint64 size = m_file.size();
+    if (size < headerSize) {
+        m_file.close();
+        return std::unexpected{QString{"File %1 is too small."}.arg(m_fileName)};
+    }
+
+    const uchar* mapped = m_file.map(0, size);
+    if (mapped == nullptr) {
+        const QString error = m_file.errorString();
+        m_file.close();
+        return std::unexpected{QString{"Can not map %1: %2"}.arg(m_fileName, error)};
+    }
+
+    const quint32 magic = qFromLittleEndian<quint32>(mapped);
+    const quint16 version = qFromLittleEndian<quint16>(mapped + 4);
+    const quint32 entryCount = qFromLittleEndian<quint32>(mapped + 8);
+
+    QString error;
+    if (magic != fileMagic)
+        error = QString{"File %1 is not a settings file."}.arg(m_fileName);
+    else if (version != formatVersion)
+        error = QString{"File %1 has unsupported version %2."}.arg(m_fileName).arg(version);
+    else if (headerSize + entrySize * entryCount > size)
+        error = QString{"Index of %1 is truncated."}.arg(m_fileName);
+
+    if (!error.isEmpty()) {
+        m_file.unmap(const_cast<uchar*>(mapped));
+        m_file.close();
+        return std::unexpected{error};
+    }
+
+    p_mapped = mapped;
+    m_mappedSize = size;
+    m_entryCount = entryCount;
+    return {};
+}
+
+std::expected<void,QString> BinarySettingsBackend::commit()
+{
+    if (m_changes.isEmpty())
+        return {};
+
+    // Collect all entries first: mapped data must not be referenced while the file is being replaced.
+    QVector<PendingEntry> entries;
+    entries.reserve(static_cast<int>(m_entryCount) + m_changes.size());
+
+    for (quint32 i = 0; i < m_entryCount; i++) {
+        const uchar* entry = p_mapped + headerSize + entrySize * i;
+        const quint32 keyOffset = qFromLittleEndian<quint32>(entry + 8);
+        const quint32 keySize = qFromLittleEndian<quint32>(entry + 12);
+        const quint32 valueOffset = qFromLittleEndian<quint32>(entry + 16);
+        const quint32 valueSize = qFromLittleEndian<quint32>(entry + 20);
+        if (qint64{keyOffset} + keySize > m_mappedSize || qint64{valueOffset} + valueSize > m_mappedSize)
+            continue;
+
+        const QByteArray key{reinterpret_cast<const char*>(p_mapped + keyOffset), static_cast<int>(keySize)};
+        if (m_changes.contains(QString::fromUtf8(key)))
+            continue;
+
+        entries.append(PendingEntry{
+            qFromLittleEndian<quint64>(entry),
+            key,
+            entry[24],
+            QByteArray{reinterpret_cast<const char*>(p_mapped + valueOffset), static_cast<int>(valueSize)}
+        });
+    }
+
+    for (auto iter = m_changes.cbegin(); iter != m_changes.cend(); ++iter) {
+        const QByteArray key = iter.key().toUtf8();
+        entries.append(PendingEntry{
+            draupnir::utils::fnv1a_64(std::string_view{key.constData(), static_cast<size_t>(key.size())}),
+            key,
+            iter.value().first,
+            iter.value().second
+        });
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const PendingEntry& left, const PendingEntry& right) {
+        return (left.hash != right.hash) ? left.hash < right.hash : left.key < right.key;
+    });
+
+    qint64 totalSize = headerSize + entrySize * entries.size();
+    for (const PendingEntry& entry : std::as_const(entries))
+        totalSize += entry.key.size() + entry.value.size();
+    if (totalSize > std::numeric_limits<quint32>::max())
+        return std::unexpected{QString{"Settings do not fit into %1."}.arg(m_fileName)};
+
+    QByteArray content{static_cast<int>(headerSize + entrySize * entries.size()), '\0'};
+    content.reserve(static_cast<int>(totalSize));
+    uchar* header = reinterpret_cast<uchar*>(content.data());
+    qToLittleEndian<quint32>(fileMagic, header);
+    qToLittleEndian<quint16>(formatVersion, header + 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(entries.size()), header + 8);
+
+    for (int i = 0; i < entries.size(); i++) {
+        const PendingEntry& entry = entries.at(i);
+        const quint32 keyOffset = static_cast<quint32>(content.size());
+        content.append(entry.key);
+        const quint32 valueOffset = static_cast<quint32>(content.size());
+        content.append(entry.value);
+
+        uchar* index = reinterpret_cast<uchar*>(content.data()) + headerSize + entrySize * i;
+        qToLittleEndian<quint64>(entry.hash, index);
+        qToLittleEndian<quint32>(keyOffset, index + 8);
+        qToLittleEndian<quint32>(static_cast<quint32>(entry.key.size()), index + 12);
+        qToLittleEndian<quint32>(valueOffset, index + 16);
+        qToLittleEndian<quint32>(static_cast<quint32>(entry.value.size()), index + 20);
+        index[24] = entry.type;
+    }
+
+    // Old mapping must be released before the file is replaced (required on Windows).
+    _unmap();
+
+    QSaveFile file{m_fileName};
+    QString error;
+    if (!file.open(QIODevice::WriteOnly))
+        error = QString{"Can not open %1 for writing: %2"}.arg(m_fileName, file.errorString());
+    else if (file.write(content) != content.size())
+        error = QString{"Can not write %1: %2"}.arg(m_fileName, file.errorString());
+    else if (!file.commit())
+        error = QString{"Can not replace %1: %2"}.arg(m_fileName, file.errorString());
+
+    if (!error.isEmpty()) {
+        file.cancelWriting();
+        load();
+        return std::unexpected{error};
+    }
+
+    m_changes.clear();
+    return load();
+}
+
+int BinarySettingsBackend::count() const
+{
+    int result = static_cast<int>(m_entryCount);
+    for (auto iter = m_changes.cbegin(); iter != m_changes.cend(); ++iter) {
+        if (!_findMapped(iter.key()))
+            result++;
+    }
+    return result;
+}
+
+void BinarySettingsBackend::reload()
+{
+    if (const auto loaded = load(); !loaded)
+        qWarning() << "BinarySettingsBackend: failed to reload" << m_fileName << ":" << loaded.error();
+}
+
+bool BinarySettingsBackend::contains(const QString& key) const
+{
+    return _find(key).has_value();
+}
+
+QVariant BinarySettingsBackend::value(const QString& key, const QVariant& defaultValue)
+{
+    const std::optional<EncodedValue> encoded = _find(key);
+    if (!encoded)
+        return defaultValue;
+
+    switch (encoded->type) {
+    case Int64:
+        return (encoded->size == sizeof(qint64)) ? QVariant{qFromLittleEndian<qint64>(encoded->data)} : defaultValue;
+    case Double:
+        return (encoded->size == sizeof(double)) ? QVariant{decodeDouble(encoded->data)} : defaultValue;
+    case String:
+        return QVariant{QString::fromUtf8(encoded->data, encoded->size)};
+    case Bytes:
+        return QVariant{QByteArray{encoded->data, encoded->size}};
+    case Variant: {
+        QDataStream stream{QByteArray::fromRawData(encoded->data, encoded->size)};
+        stream.setVersion(QDataStream::Qt_5_15);
+        QVariant result;
+        stream >> result;
+        return (stream.status() == QDataStream::Ok) ? result : defaultValue;
+    }
+    }
+    return defaultValue;
+}
+
+void BinarySettingsBackend::setValue(const QString& key, const QVariant& value)
+{
+    QByteArray data;
+    QDataStream stream{&data, QIODevice::WriteOnly};
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << value;
+    _set(key, Variant, data);
+}
+
+std::optional<qint64> BinarySettingsBackend::getInt64(const QString& key)
+{
+    const std::optional<EncodedValue> encoded = _find(key);
+    if (!encoded || encoded->type != Int64 || encoded->size != sizeof(qint64))
+        return std::nullopt;
+    return qFromLittleEndian<qint64>(encoded->data);
+}
+
+void BinarySettingsBackend::setInt64(const QString& key, qint64 value)
+{
+    _set(key, Int64, encodeInt64(value));
+}
+
+std::optional<double> BinarySettingsBackend::getDouble(const QString& key)
+{
+    const std::optional<EncodedValue> encoded = _find(key);
+    if (!encoded || encoded->type != Double || encoded->size != sizeof(double))
+        return std::nullopt;
+    return decodeDouble(encoded->data);
+}
+
+void BinarySettingsBackend::setDouble(const QString& key, double value)
+{
+    _set(key, Double, encodeDouble(value));
+}
+
+std::optional<QString> BinarySettingsBackend::getString(const QString& key)
+{
+    const std::optional<EncodedValue> encoded = _find(key);
+    if (!encoded || encoded->type != String)
+        return std::nullopt;
+    return QString::fromUtf8(encoded->data, encoded->size);
+}
+
+void BinarySettingsBackend::setString(const QString& key, const QString& value)
+{
+    _set(key, String, value.toUtf8());
+}
+
+std::optional<QByteArray> BinarySettingsBackend::getBytes(const QString& key)
+{
+    const std::optional<EncodedValue> encoded = _find(key);
+    if (!encoded || encoded->type != Bytes)
+        return std::nullopt;
+    return QByteArray{encoded->data, encoded->size};
+}
+
+void BinarySettingsBackend::setBytes(const QString& key, const QByteArray& value)
+{
+    _set(key, Bytes, value);
+}
+
+void BinarySettingsBackend::_unmap()
+{
+    if (p_mapped != nullptr)
+        m_file.unmap(const_cast<uchar*>(p_mapped));
+    if (m_file.isOpen())
+        m_file.close();
+
+    p_mapped = nullptr;
+    m_mappedSize = 0;
+    m_entryCount = 0;
+}
+
+std::optional<BinarySettingsBackend::EncodedValue> BinarySettingsBackend::_find(const QString& key) const
+{
+    if (!m_changes.isEmpty()) {
+        const auto iter = m_changes.constFind(key);
+        if (iter != m_changes.constEnd())
+            return EncodedValue{iter.value().first, iter.value().second.constData(), iter.value().second.size()};
+    }
+    return _findMapped(key);
+}
+
+std::optional<BinarySettingsBackend::EncodedValue> BinarySettingsBackend::_findMapped(const QString& key) const
+{
+    if (m_entryCount == 0)
+        return std::nullopt;
+
+    const quint64 hash = keyHash(key);
+    const uchar* index = p_mapped + headerSize;
+
+    // Lower bound of the hash within the sorted index.
+    quint32 first = 0;
+    quint32 count = m_entryCount;
+    while (count > 0) {
+        const quint32 step = count / 2;
+        if (qFromLittleEndian<quint64>(index + entrySize * (first + step)) < hash) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    for (quint32 i = first; i < m_entryCount; i++) {
+        const uchar* entry = index + entrySize * i;
+        if (qFromLittleEndian<quint64>(entry) != hash)
+            break;
+
+        const quint32 keyOffset = qFromLittleEndian<quint32>(entry + 8);
+        const quint32 keySize = qFromLittleEndian<quint32>(entry + 12);
+        const quint32 valueOffset = qFromLittleEndian<quint32>(entry + 16);
+        const quint32 valueSize = qFromLittleEndian<quint32>(entry + 20);
+        if (qint64{keyOffset} + keySize > m_mappedSize || qint64{valueOffset} + valueSize > m_mappedSize)
+            continue;
+
+        if (keyEquals(key, reinterpret_cast<const char*>(p_mapped + keyOffset), static_cast<int>(keySize))) {
+            return EncodedValue{
+                static_cast<ValueType>(entry[24]),
+                reinterpret_cast<const char*>(p_mapped + valueOffset),
+                static_cast<int>(valueSize)
+            };
+        }
+    }
+    return std::nullopt;
+}
+
+void BinarySettingsBackend::_set(const QString& key, ValueType type, const QByteArray& data)
+{
+    m_changes.insert(key, qMakePair(type, data));
+}
+
+}; // namespace Draupnir::Settings
@@ -26,6 +26,11 @@
 #define DUMMYFILES_H
 
 #include "draupnir/files/file_types/AbstractJsonFile.h"
+#include "draupnir/files/file_types/AbstractStreamingJsonFile.h"
+#include "draupnir/files/file_types/AbstractXmlFile.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
 
 class DummyTextFile : public Draupnir::Files::AbstractTextFile
 {
@@ -42,6 +47,65 @@ protected:
     QByteArray currentData() const override { return data; }
 };
 
+class DummyChunkedTextFile : public Draupnir::Files::AbstractTextFile
+{
+public:
+    QByteArray data;
+    qint64 chunkSize = 4;
+    int chunkCount = 0;
+    int failAtChunk = -1;
+
+protected:
+    qint64 loadChunkSize() const override { return chunkSize; }
+
+    std::expected<void,QString> chunkedLoadStarted(qint64 totalSize) override {
+        m_pending.clear();
+        m_pending.reserve(totalSize);
+        chunkCount = 0;
+        return {};
+    }
+
+    std::expected<void,QString> dataChunkProcessed(const QByteArray& chunk) override {
+        if (chunkCount++ == failAtChunk)
+            return std::unexpected{QString{"Chunk rejected."}};
+
+        m_pending.append(chunk.constData(), chunk.size());
+        return {};
+    }
+
+    std::expected<void,QString> finish() override {
+        data = m_pending;
+        return {};
+    }
+
+    QByteArray currentData() const override { return data; }
+
+private:
+    QByteArray m_pending;
+};
+
+class DummyMappedTextFile : public Draupnir::Files::AbstractTextFile
+{
+public:
+    QByteArray data;
+    int releaseCount = 0;
+
+protected:
+    bool isMemoryMappingEnabled() const override { return true; }
+
+    void mappedDataAboutToBeReleased() override {
+        releaseCount++;
+        data.detach();
+    }
+
+    std::expected<void,QString> dataProcessed(const QByteArray& data) override {
+        this->data = data;
+        return {};
+    }
+
+    QByteArray currentData() const override { return data; }
+};
+
 class DummyJsonFile : public Draupnir::Files::AbstractJsonFile
 {
 public:
@@ -58,4 +122,166 @@ protected:
     }
 };
 
+/*! @brief Streaming JSON file rebuilding QJsonDocument from parser events, so results can be compared with AbstractJsonFile. */
+class DummyStreamingJsonFile : public Draupnir::Files::AbstractStreamingJsonFile
+{
+public:
+    QJsonDocument jsonDocument;
+    qint64 chunkSize = defaultJsonChunkSize;
+    int eventCount = 0;
+    QJsonDocument::JsonFormat format = QJsonDocument::Indented;
+
+protected:
+    qint64 loadChunkSize() const override { return chunkSize; }
+
+    std::expected<void,QString> jsonLoadStarted(qint64 totalSize) override {
+        Q_UNUSED(totalSize);
+        m_stack.clear();
+        m_root = QJsonValue{};
+        m_eventCount = 0;
+        return {};
+    }
+
+    std::expected<void,QString> jsonObjectStarted() override {
+        m_eventCount++;
+        m_stack.append(Container{true, {}, {}, {}});
+        return {};
+    }
+
+    std::expected<void,QString> jsonObjectFinished() override {
+        m_eventCount++;
+        return _valueParsed(m_stack.takeLast().object);
+    }
+
+    std::expected<void,QString> jsonArrayStarted() override {
+        m_eventCount++;
+        m_stack.append(Container{false, {}, {}, {}});
+        return {};
+    }
+
+    std::expected<void,QString> jsonArrayFinished() override {
+        m_eventCount++;
+        return _valueParsed(m_stack.takeLast().array);
+    }
+
+    std::expected<void,QString> jsonKeyParsed(const QString& key) override {
+        m_eventCount++;
+        m_stack.last().key = key;
+        return {};
+    }
+
+    std::expected<void,QString> jsonValueParsed(const QJsonValue& value) override {
+        m_eventCount++;
+        return _valueParsed(value);
+    }
+
+    std::expected<void,QString> jsonLoadFinished() override {
+        if (m_root.isObject())
+            jsonDocument = QJsonDocument{m_root.toObject()};
+        else if (m_root.isArray())
+            jsonDocument = QJsonDocument{m_root.toArray()};
+        else
+            return std::unexpected{QString{"Document must be an object or an array."}};
+
+        eventCount = m_eventCount;
+        return {};
+    }
+
+    void writeJson(Draupnir::Files::JsonStreamWriter& writer) const override {
+        writer.writeValue(jsonDocument.isArray() ? QJsonValue{jsonDocument.array()} : QJsonValue{jsonDocument.object()});
+    }
+
+    QJsonDocument::JsonFormat jsonFormat() const override { return format; }
+
+private:
+    struct Container {
+        bool isObject;
+        QJsonObject object;
+        QJsonArray array;
+        QString key;
+    };
+
+    QList<Container> m_stack;
+    QJsonValue m_root;
+    int m_eventCount = 0;
+
+    std::expected<void,QString> _valueParsed(const QJsonValue& value) {
+        if (m_stack.isEmpty())
+            m_root = value;
+        else if (m_stack.last().isObject)
+            m_stack.last().object.insert(m_stack.last().key, value);
+        else
+            m_stack.last().array.append(value);
+        return {};
+    }
+};
+
+/*! @brief XML file with a `<project>` root element containing `<item id="...">text</item>` elements. */
+class DummyXmlFile : public Draupnir::Files::AbstractXmlFile
+{
+public:
+    struct Item {
+        QString id;
+        QString text;
+        bool operator==(const Item& other) const { return id == other.id && text == other.text; }
+    };
+
+    QList<Item> items;
+    qint64 chunkSize = defaultXmlChunkSize;
+
+protected:
+    qint64 loadChunkSize() const override { return chunkSize; }
+
+    std::expected<void,QString> xmlLoadStarted(qint64 totalSize) override {
+        Q_UNUSED(totalSize);
+        m_pendingItems.clear();
+        m_insideItem = false;
+        return {};
+    }
+
+    std::expected<void,QString> xmlElementStarted(const QXmlStreamReader& reader) override {
+        if (reader.name() == QLatin1String("project"))
+            return {};
+
+        if (reader.name() != QLatin1String("item") || m_insideItem)
+            return std::unexpected{QString{"Unexpected element %1."}.arg(reader.name().toString())};
+
+        m_insideItem = true;
+        m_pendingItems.append(Item{reader.attributes().value(QLatin1String("id")).toString(), QString{}});
+        return {};
+    }
+
+    std::expected<void,QString> xmlElementFinished(const QXmlStreamReader& reader) override {
+        if (reader.name() == QLatin1String("item"))
+            m_insideItem = false;
+        return {};
+    }
+
+    std::expected<void,QString> xmlCharactersParsed(const QXmlStreamReader& reader) override {
+        if (m_insideItem)
+            m_pendingItems.last().text.append(reader.text().toString());
+        return {};
+    }
+
+    std::expected<void,QString> xmlLoadFinished() override {
+        items = m_pendingItems;
+        return {};
+    }
+
+    void writeXml(QXmlStreamWriter& writer) const override {
+        writer.writeStartElement(QLatin1String("project"));
+        for (const Item& item : items) {
+            writer.writeStartElement(QLatin1String("item"));
+            writer.writeAttribute(QLatin1String("id"), item.id);
+            writer.writeCharacters(item.text);
+            writer.writeEndElement();
+        }
+        writer.writeEndElement();
+    }
+
+private:
+    QList<Item> m_pendingItems;
+    bool m_insideItem = false;
+};
+
 #endif // DUMMYFILES_H
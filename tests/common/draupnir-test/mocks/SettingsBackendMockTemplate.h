@@ -29,6 +29,7 @@
 
 #include "draupnir/settings_registry/core/SettingsBackendInterface.h"
 #include "draupnir/settings_registry/core/SettingTemplate.h"
+#include "draupnir/settings_registry/utils/SettingTraitKey.h"
 #include "draupnir/settings_registry/utils/ValueSerializerTemplate.h"
 
 /*! @class SettingsBackendMockTemplate tests/common/mocks/SettingsBackendMockTemplate.h
@@ -57,7 +58,7 @@ public:
 
     template<Draupnir::Settings::PrimitiveSettingTraitConcept Trait>
     QVariant getQVariant() {
-        return value(Trait::key(), Draupnir::Settings::ValueSerializerTemplate<typename Trait::Value>::toQVariant(Trait::defaultValue()));
+        return value(Draupnir::Settings::SettingTraitKey<Trait>::qString(), Draupnir::Settings::ValueSerializerTemplate<typename Trait::Value>::toQVariant(Trait::defaultValue()));
     }
 
 private:
@@ -65,7 +66,7 @@ private:
 
     template<class First,class... Rest>
     bool _containsImpl(const QString& key) const {
-        if (First::key() == key) {
+        if (Draupnir::Settings::SettingTraitKey<First>::qString() == key) {
             return true;
         }
 
@@ -78,7 +79,7 @@ private:
 
     template<std::size_t Index, class First,class... Rest>
     QVariant _valueImpl(const QString& key, const QVariant& defaultValue = QVariant()) {
-        if (First::key() == key)
+        if (Draupnir::Settings::SettingTraitKey<First>::qString() == key)
             return m_variantArray.at(Index);
 
         if constexpr (sizeof...(Rest) > 0) {
@@ -90,7 +91,7 @@ private:
 
     template<std::size_t Index, class First,class... Rest>
     void _setValueImpl(const QString& key, const QVariant& value) {
-        if (First::key() == key) {
+        if (Draupnir::Settings::SettingTraitKey<First>::qString() == key) {
             m_variantArray[Index] = value;
             return;
         }
@@ -0,0 +1,197 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+#include <QCborValue>
+
+#include "draupnir-test/helpers/FileTestHelpers.h"
+#include "draupnir-test/mocks/DummyFiles.h"
+
+/*! @class AbstractStreamingJsonFileTest tests/modules/files/unit/AbstractStreamingJsonFileTest.cpp
+ *  @ingroup Files
+ *  @ingroup Tests
+ *  @brief Unit tests for @ref Draupnir::Files::AbstractStreamingJsonFile class. */
+
+class AbstractStreamingJsonFileTest : public QObject
+{
+    Q_OBJECT
+private:
+    const QJsonDocument jsonDocument{QJsonObject{
+        { "array", QJsonArray{{1,2,3}} },
+        { "boolean", true },
+        { "color", "gold" },
+        { "double", -12.5e-3 },
+        { "empty_array", QJsonArray{} },
+        { "empty_object", QJsonObject{} },
+        { "escaped", "\"quoted\" \\ back/slash\n\ttab \u00e9\u20ac \U0001F600 \x01" },
+        { "null" , QJsonValue::Null },
+        { "number", 123 },
+        { "object", QJsonObject{ { "a", "b" }, { "c", QJsonArray{ QJsonObject{ { "d", false } } } } } },
+        { "string", "Hello World" }
+    }};
+    QString validJsonFilePath;
+
+    const QByteArray invalidJsonData{QByteArray{
+        "{"
+            "\"array\": [1,2,3],"
+            "\"boolean\" I Am Broken Json!: true,"
+            "\"color\": \"gold\""
+        "}"
+    }};
+    QString invalidJsonFilePath;
+
+    const QString filePathToWrite{"streaming_json_file_written.json"};
+
+    DummyStreamingJsonFile* file = nullptr;
+
+private slots:
+    void initTestCase() {
+        auto result = FileTestHelper::createTempFile(
+            "valid_streaming_json.json", jsonDocument.toJson() );
+        QVERIFY(result.has_value());
+        validJsonFilePath = result.value();
+
+        result = FileTestHelper::createTempFile(
+            "invalid_streaming_json.json", invalidJsonData );
+        QVERIFY(result.has_value());
+        invalidJsonFilePath = result.value();
+    };
+
+    void init() { file = new DummyStreamingJsonFile; }
+    void cleanup() { delete file; file = nullptr; }
+
+    void test_file_open() {
+        auto result = file->open(QFileInfo{validJsonFilePath});
+        QCOMPARE(result.has_value(), true);
+        QCOMPARE(file->jsonDocument, jsonDocument);
+        QVERIFY(file->eventCount > 0);
+    }
+
+    void test_file_open_split_into_tiny_chunks() {
+        // Every token is split between chunks.
+        for (const qint64 chunkSize : {1, 2, 3, 7}) {
+            file->chunkSize = chunkSize;
+            auto result = file->open(QFileInfo{validJsonFilePath});
+            QCOMPARE(result.has_value(), true);
+            QCOMPARE(file->jsonDocument, jsonDocument);
+        }
+    }
+
+    void test_file_open_compact_document() {
+        auto result = FileTestHelper::createTempFile(
+            "compact_streaming_json.json", jsonDocument.toJson(QJsonDocument::Compact) );
+        QVERIFY(result.has_value());
+
+        file->chunkSize = 5;
+        QCOMPARE(file->open(QFileInfo{result.value()}).has_value(), true);
+        QCOMPARE(file->jsonDocument, jsonDocument);
+    }
+
+    void test_file_open_invalid_file() {
+        auto result = file->open(QFileInfo{invalidJsonFilePath});
+        QCOMPARE(result.has_value(), false);
+        QVERIFY(file->jsonDocument.isNull());
+    }
+
+    void test_file_open_malformed_documents_data() {
+        QTest::addColumn<QByteArray>("data");
+
+        QTest::newRow("empty")                  << QByteArray{""};
+        QTest::newRow("truncated")              << QByteArray{"{\"a\": [1, 2"};
+        QTest::newRow("unterminated_string")    << QByteArray{"{\"a\": \"text"};
+        QTest::newRow("trailing_comma")         << QByteArray{"[1, 2,]"};
+        QTest::newRow("missing_colon")          << QByteArray{"{\"a\" 1}"};
+        QTest::newRow("mismatched_brackets")    << QByteArray{"{\"a\": 1]"};
+        QTest::newRow("invalid_literal")        << QByteArray{"[tru]"};
+        QTest::newRow("invalid_number")         << QByteArray{"[01]"};
+        QTest::newRow("invalid_escape")         << QByteArray{"[\"\\x\"]"};
+        QTest::newRow("control_character")      << QByteArray{"[\"a\tb\"]"};
+        QTest::newRow("two_documents")          << QByteArray{"[1] [2]"};
+        QTest::newRow("too_deep")               << QByteArray(Draupnir::Files::JsonStreamReader::maximumDepth + 1, '[');
+    }
+
+    void test_file_open_malformed_documents() {
+        QFETCH(QByteArray, data);
+
+        auto filePath = FileTestHelper::createTempFile("malformed_streaming_json.json", data);
+        QVERIFY(filePath.has_value());
+
+        file->chunkSize = 2;
+        QCOMPARE(file->open(QFileInfo{filePath.value()}).has_value(), false);
+    }
+
+    void test_file_save_as() {
+        file->jsonDocument = jsonDocument;
+        auto result = file->saveAs(filePathToWrite);
+        QCOMPARE(result.has_value(), true);
+
+        // Streamed output is the same as of QJsonDocument.
+        const QByteArray dataWritten{FileTestHelper::tempFileData(filePathToWrite).value()};
+        QCOMPARE(dataWritten, jsonDocument.toJson());
+    };
+
+    void test_file_save_as_compact() {
+        file->jsonDocument = jsonDocument;
+        file->format = QJsonDocument::Compact;
+        QCOMPARE(file->saveAs(filePathToWrite).has_value(), true);
+
+        const QByteArray dataWritten{FileTestHelper::tempFileData(filePathToWrite).value()};
+        QCOMPARE(dataWritten, jsonDocument.toJson(QJsonDocument::Compact));
+    }
+
+    void test_escaped_unicode_is_decoded() {
+        auto filePath = FileTestHelper::createTempFile("unicode_streaming_json.json",
+            QByteArray{"[\"\\u00e9\\u20AC\\ud83d\\ude00\\/\", 9007199254740993, 1e2]"});
+        QVERIFY(filePath.has_value());
+
+        QCOMPARE(file->open(QFileInfo{filePath.value()}).has_value(), true);
+        const QJsonArray array = file->jsonDocument.array();
+        QCOMPARE(array.size(), 3);
+        QCOMPARE(array.at(0).toString(), QString::fromUtf8("\u00e9\u20ac\U0001F600/"));
+        // Not representable as double, must be kept as integer.
+        QCOMPARE(QCborValue::fromJsonValue(array.at(1)).toInteger(), Q_INT64_C(9007199254740993));
+        QCOMPARE(array.at(2).toDouble(), 100.0);
+    }
+
+    void test_large_integer_round_trip() {
+        const qint64 largeInteger = Q_INT64_C(9007199254740993);
+        file->jsonDocument = QJsonDocument{QJsonArray{QJsonValue{largeInteger}, QJsonValue{-largeInteger}}};
+        file->format = QJsonDocument::Compact;
+        QCOMPARE(file->saveAs(filePathToWrite).has_value(), true);
+
+        const QByteArray dataWritten{FileTestHelper::tempFileData(filePathToWrite).value()};
+        QCOMPARE(dataWritten, QByteArray{"[9007199254740993,-9007199254740993]"});
+
+        DummyStreamingJsonFile reopened;
+        QCOMPARE(reopened.open(file->fileInfo()).has_value(), true);
+        const QJsonArray array = reopened.jsonDocument.array();
+        QCOMPARE(array.size(), 2);
+        QCOMPARE(QCborValue::fromJsonValue(array.at(0)).toInteger(), largeInteger);
+        QCOMPARE(QCborValue::fromJsonValue(array.at(1)).toInteger(), -largeInteger);
+    }
+};
+
+QTEST_MAIN(AbstractStreamingJsonFileTest)
+
+#include "AbstractStreamingJsonFileTest.moc"
@@ -0,0 +1,11 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+include(../../../../common/DummyFile.pri)
+include(../../../../common/FileTestHelpers.pri)
+
+QT += widgets
+
+include(../../../../../modules/DraupnirFiles.pri)
+
+SOURCES += \
+    AbstractStreamingJsonFileTest.cpp
@@ -26,6 +26,8 @@
 
 #include <QSignalSpy>
 
+#include "draupnir/files/core/FileWatcherService.h"
+
 #include "draupnir-test/helpers/FileTestHelpers.h"
 #include "draupnir-test/mocks/DummyFiles.h"
 
@@ -271,6 +273,65 @@ private slots:
         QCOMPARE(unsavedDataStatusChangedSignalSpy->count(), 0);
     }
 
+    void test_chunked_file_opening() {
+        DummyChunkedTextFile chunkedFile;
+        QSignalSpy chunkedFileInfoSpy{&chunkedFile, &DummyChunkedTextFile::fileInfoChanged};
+
+        auto result = chunkedFile.open(filePathToRead);
+        QVERIFY(result);
+        QCOMPARE(chunkedFile.data, fileData);
+        // "VeryRandomData" is 14 bytes long, so it is read within 4 chunks of 4 bytes.
+        QCOMPARE(chunkedFile.chunkCount, 4);
+        QCOMPARE(chunkedFileInfoSpy.count(), 1);
+        QCOMPARE(chunkedFile.fileInfo().absoluteFilePath(), filePathToRead);
+    }
+
+    void test_chunked_file_open_failure() {
+        DummyChunkedTextFile chunkedFile;
+        QVERIFY(chunkedFile.open(anotherFilePathToRead));
+        QCOMPARE(chunkedFile.data, anotherFileData);
+
+        QSignalSpy chunkedFileInfoSpy{&chunkedFile, &DummyChunkedTextFile::fileInfoChanged};
+        chunkedFile.failAtChunk = 1;
+
+        auto result = chunkedFile.open(filePathToRead);
+        QCOMPARE(result.has_value(), false);
+        QCOMPARE(result.error().isEmpty(), false);
+        // Previously loaded data and file info must stay untouched.
+        QCOMPARE(chunkedFile.data, anotherFileData);
+        QCOMPARE(chunkedFileInfoSpy.count(), 0);
+        QCOMPARE(chunkedFile.fileInfo().absoluteFilePath(), anotherFilePathToRead);
+    }
+
+    void test_mapped_file_opening() {
+        DummyMappedTextFile mappedFile;
+
+        auto result = mappedFile.open(filePathToRead);
+        QVERIFY(result);
+        QCOMPARE(mappedFile.data, fileData);
+
+        // Opening another file releases the previous mapping without asking for a copy.
+        result = mappedFile.open(anotherFilePathToRead);
+        QVERIFY(result);
+        QCOMPARE(mappedFile.data, anotherFileData);
+        QCOMPARE(mappedFile.releaseCount, 0);
+    }
+
+    void test_mapped_file_save_over_itself() {
+        auto path = FileTestHelper::createTempFile( "mapped_file_to_write.txt", fileData );
+        QVERIFY(path);
+
+        DummyMappedTextFile mappedFile;
+        QVERIFY(mappedFile.open(path.value()));
+        QCOMPARE(mappedFile.data, fileData);
+
+        auto result = mappedFile.save();
+        QVERIFY(result);
+        QCOMPARE(mappedFile.releaseCount, 1);
+        QCOMPARE(mappedFile.data, fileData);
+        QCOMPARE(FileTestHelper::tempFileData(path.value()), fileData);
+    }
+
     void test_file_save() {
         set_file_opened(filePathToWrite);
         set_file_unsaved_state(true);
@@ -358,6 +419,61 @@ private slots:
         QCOMPARE(file->data, fileData);
     }
 
+    void test_unchanged_file_save_is_skipped() {
+        auto path = FileTestHelper::createTempFile( "unchanged_file.txt", fileData );
+        QVERIFY(path);
+        // Move modification time to the past, so rewriting the file would be visible.
+        const QDateTime pastTime = QDateTime::currentDateTime().addDays(-1);
+        {
+            QFile fileToAge{path.value()};
+            QVERIFY(fileToAge.open(QIODevice::ReadWrite));
+            QVERIFY(fileToAge.setFileTime(pastTime, QFileDevice::FileModificationTime));
+        }
+        const QDateTime modificationTime = QFileInfo{path.value()}.lastModified();
+
+        set_file_opened(path.value());
+        set_file_unsaved_state(true);
+
+        auto result = file->save();
+        QVERIFY(result);
+        QCOMPARE(file->hasUnsavedData(), false);
+        QCOMPARE(QFileInfo{path.value()}.lastModified(), modificationTime);
+
+        // Changed data is written.
+        file->data = anotherFileData;
+        result = file->save();
+        QVERIFY(result);
+        QCOMPARE(FileTestHelper::tempFileData(path.value()), anotherFileData);
+        QVERIFY(QFileInfo{path.value()}.lastModified() != modificationTime);
+    }
+
+    void test_file_touch_is_not_reported() {
+        auto path = FileTestHelper::createTempFile( "touched_file.txt", fileData );
+        QVERIFY(path);
+        set_file_opened(path.value());
+
+        // Change modification time only.
+        QFile anotherWayToAccessFile{path.value()};
+        QVERIFY(anotherWayToAccessFile.open(QIODevice::ReadWrite));
+        QVERIFY(anotherWayToAccessFile.setFileTime(QDateTime::currentDateTime().addDays(-1), QFileDevice::FileModificationTime));
+        anotherWayToAccessFile.close();
+
+        QTest::qWait(200);
+        QCOMPARE(fileModifiedOnDisk->count(), 0);
+        QCOMPARE(fileRemovedSignalSpy->count(), 0);
+    }
+
+    void test_own_save_is_not_reported() {
+        set_file_opened(filePathToWrite);
+        file->data = anotherFileData;
+
+        QVERIFY(file->save());
+
+        QTest::qWait(200);
+        QCOMPARE(fileModifiedOnDisk->count(), 0);
+        QCOMPARE(fileRemovedSignalSpy->count(), 0);
+    }
+
     void test_file_external_edit() {
         QFile anotherWayToAccessFile{fileToBeEdited};
         QVERIFY(anotherWayToAccessFile.exists());
@@ -375,6 +491,48 @@ private slots:
         QCOMPARE(fileRemovedSignalSpy->count(), 0);
     }
 
+    void test_file_external_edit_burst() {
+        auto path = FileTestHelper::createTempFile( "to_be_edited_in_burst.txt", fileData );
+        QVERIFY(path);
+        set_file_opened(path.value());
+
+        // Several writes in a row, like editors saving with truncate + write.
+        for (const QByteArray& data : {QByteArray{"1"}, QByteArray{"22"}, anotherFileData}) {
+            QFile anotherWayToAccessFile{path.value()};
+            QVERIFY(anotherWayToAccessFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+            QVERIFY(anotherWayToAccessFile.write(data) == data.size());
+            anotherWayToAccessFile.close();
+        }
+
+        QTRY_COMPARE(fileModifiedOnDisk->count(), 1);
+        QTest::qWait(2 * Draupnir::Files::FileWatcherService::instance()->debounceInterval());
+        QCOMPARE(fileModifiedOnDisk->count(), 1);
+        QCOMPARE(fileRemovedSignalSpy->count(), 0);
+    }
+
+    void test_file_external_replace_by_rename() {
+        auto path = FileTestHelper::createTempFile( "to_be_replaced.txt", fileData );
+        QVERIFY(path);
+        set_file_opened(path.value());
+
+        // Replace the file by renaming another one over it.
+        auto replacement = FileTestHelper::createTempFile( "replacement.txt", anotherFileData );
+        QVERIFY(replacement);
+        QVERIFY(QFile::remove(path.value()));
+        QVERIFY(QFile::rename(replacement.value(), path.value()));
+
+        QTRY_COMPARE(fileModifiedOnDisk->count(), 1);
+        fileModifiedOnDisk->clear();
+
+        // Watching continues after the file was replaced.
+        QFile anotherWayToAccessFile{path.value()};
+        QVERIFY(anotherWayToAccessFile.open(QIODevice::WriteOnly | QIODevice::Append));
+        QVERIFY(anotherWayToAccessFile.write(fileData) == fileData.size());
+        anotherWayToAccessFile.close();
+
+        QTRY_COMPARE(fileModifiedOnDisk->count(), 1);
+    }
+
     void test_file_external_removal() {
         QFile anotherWayToAccessFile{fileToBeRemoved};
         QVERIFY(anotherWayToAccessFile.exists());
@@ -389,6 +547,38 @@ private slots:
         QCOMPARE(fileRemovedSignalSpy->first().count(), 0);
         QCOMPARE(fileModifiedOnDisk->count(), 0);
     }
+
+    void test_file_opened_on_worker_thread_is_watched() {
+        auto firstPath = FileTestHelper::createTempFile( "opened_on_worker_thread.txt", fileData );
+        QVERIFY(firstPath);
+        auto secondPath = FileTestHelper::createTempFile( "reopened_on_worker_thread.txt", fileData );
+        QVERIFY(secondPath);
+        auto* watcherService = Draupnir::Files::FileWatcherService::instance();
+
+        const auto openOnWorkerThread = [this](const QString& filePath) {
+            std::expected<void,QString> result;
+            QThread* thread = QThread::create([this, &filePath, &result]() { result = file->open(filePath); });
+            thread->start();
+            const bool finished = thread->wait(5000);
+            delete thread;
+            return finished && result.has_value();
+        };
+
+        QVERIFY(openOnWorkerThread(firstPath.value()));
+        QVERIFY(watcherService->isWatched(firstPath.value()));
+
+        // Path is watched on the thread of the service, so external edits are reported.
+        QFile anotherWayToAccessFile{firstPath.value()};
+        QVERIFY(anotherWayToAccessFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QVERIFY(anotherWayToAccessFile.write(anotherFileData) == anotherFileData.size());
+        anotherWayToAccessFile.close();
+        QTRY_COMPARE(fileModifiedOnDisk->count(), 1);
+
+        // Opening another file on a worker thread moves the registration.
+        QVERIFY(openOnWorkerThread(secondPath.value()));
+        QVERIFY(!watcherService->isWatched(firstPath.value()));
+        QVERIFY(watcherService->isWatched(secondPath.value()));
+    }
 };
 
 QTEST_MAIN(AbstractTextFileTest)
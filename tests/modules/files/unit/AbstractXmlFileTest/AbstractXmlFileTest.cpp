@@ -0,0 +1,177 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+
+#include "draupnir-test/helpers/FileTestHelpers.h"
+#include "draupnir-test/mocks/DummyFiles.h"
+
+/*! @class AbstractXmlFileTest tests/modules/files/unit/AbstractXmlFileTest.cpp
+ *  @ingroup Files
+ *  @ingroup Tests
+ *  @brief Unit tests for @ref Draupnir::Files::AbstractXmlFile class. */
+
+class AbstractXmlFileTest : public QObject
+{
+    Q_OBJECT
+private:
+    const QByteArray validXmlData{
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- Project file -->\n"
+        "<project>\n"
+        "    <item id=\"first\">Hello World</item>\n"
+        "    <item id=\"second\">Caf\xc3\xa9 &amp; <![CDATA[<raw>]]></item>\n"
+        "    <item id=\"third\"/>\n"
+        "</project>\n"
+    };
+    const QList<DummyXmlFile::Item> validXmlItems{
+        { "first", "Hello World" },
+        { "second", QString::fromUtf8("Caf\xc3\xa9 & <raw>") },
+        { "third", "" }
+    };
+    QString validXmlFilePath;
+
+    const QByteArray invalidXmlData{
+        "<project>\n"
+        "    <item id=\"first\">Hello World</iten>\n"
+        "</project>\n"
+    };
+    QString invalidXmlFilePath;
+
+    const QString filePathToWrite{"xml_file_written.xml"};
+
+    DummyXmlFile* file = nullptr;
+
+private slots:
+    void initTestCase() {
+        auto result = FileTestHelper::createTempFile("valid_xml.xml", validXmlData);
+        QVERIFY(result.has_value());
+        validXmlFilePath = result.value();
+
+        result = FileTestHelper::createTempFile("invalid_xml.xml", invalidXmlData);
+        QVERIFY(result.has_value());
+        invalidXmlFilePath = result.value();
+    };
+
+    void init() { file = new DummyXmlFile; }
+    void cleanup() { delete file; file = nullptr; }
+
+    void test_file_open() {
+        auto result = file->open(QFileInfo{validXmlFilePath});
+        QCOMPARE(result.has_value(), true);
+        QCOMPARE(file->items, validXmlItems);
+    }
+
+    void test_file_open_split_into_tiny_chunks() {
+        // Every token is split between chunks, text may be reported in several parts.
+        for (const qint64 chunkSize : {1, 2, 3, 7}) {
+            file->chunkSize = chunkSize;
+            auto result = file->open(QFileInfo{validXmlFilePath});
+            QCOMPARE(result.has_value(), true);
+            QCOMPARE(file->items, validXmlItems);
+        }
+    }
+
+    void test_file_open_invalid_file() {
+        file->items = validXmlItems;
+
+        auto result = file->open(QFileInfo{invalidXmlFilePath});
+        QCOMPARE(result.has_value(), false);
+        // Partially parsed data is not applied.
+        QCOMPARE(file->items, validXmlItems);
+    }
+
+    void test_file_open_truncated_file() {
+        auto filePath = FileTestHelper::createTempFile("truncated_xml.xml",
+            validXmlData.left(validXmlData.indexOf("</project>")));
+        QVERIFY(filePath.has_value());
+
+        file->chunkSize = 16;
+        QCOMPARE(file->open(QFileInfo{filePath.value()}).has_value(), false);
+    }
+
+    void test_file_open_extra_content_data() {
+        QTest::addColumn<QByteArray>("trailingData");
+
+        QTest::newRow("second_root")            << QByteArray{"<project/>\n"};
+        QTest::newRow("text")                   << QByteArray{"text\n"};
+        QTest::newRow("unterminated_comment")   << QByteArray{"<!-- comment"};
+    }
+
+    void test_file_open_extra_content() {
+        QFETCH(QByteArray, trailingData);
+
+        auto filePath = FileTestHelper::createTempFile("extra_content_xml.xml", validXmlData + trailingData);
+        QVERIFY(filePath.has_value());
+
+        for (const qint64 chunkSize : {qint64{1}, qint64{4}, DummyXmlFile::defaultXmlChunkSize}) {
+            file->chunkSize = chunkSize;
+            QCOMPARE(file->open(QFileInfo{filePath.value()}).has_value(), false);
+        }
+    }
+
+    void test_file_open_trailing_comments_and_instructions() {
+        // Misc content may follow the root element, also when it starts in a later chunk.
+        auto filePath = FileTestHelper::createTempFile("trailing_misc_xml.xml",
+            validXmlData + QByteArray{"<!-- trailing comment -->\n<?processing instruction?>\n  \n"});
+        QVERIFY(filePath.has_value());
+
+        for (const qint64 chunkSize : {qint64{1}, qint64{4}, qint64{validXmlData.size()}, DummyXmlFile::defaultXmlChunkSize}) {
+            file->chunkSize = chunkSize;
+            auto result = file->open(QFileInfo{filePath.value()});
+            QCOMPARE(result.has_value(), true);
+            QCOMPARE(file->items, validXmlItems);
+        }
+    }
+
+    void test_file_open_rejected_by_derived_class() {
+        auto filePath = FileTestHelper::createTempFile("unexpected_element_xml.xml",
+            QByteArray{"<project><unknown/></project>"});
+        QVERIFY(filePath.has_value());
+
+        auto result = file->open(QFileInfo{filePath.value()});
+        QCOMPARE(result.has_value(), false);
+        QCOMPARE(result.error(), QString{"Unexpected element unknown."});
+    }
+
+    void test_file_save_as() {
+        file->items = validXmlItems;
+        auto result = file->saveAs(filePathToWrite);
+        QCOMPARE(result.has_value(), true);
+
+        const QByteArray dataWritten{FileTestHelper::tempFileData(filePathToWrite).value()};
+        QVERIFY(dataWritten.startsWith("<?xml version=\"1.0\" encoding=\"UTF-8\"?>"));
+        QVERIFY(dataWritten.contains("&lt;raw&gt;"));
+
+        // Saved file is read back to the same data.
+        DummyXmlFile readBack;
+        readBack.chunkSize = 5;
+        QCOMPARE(readBack.open(filePathToWrite).has_value(), true);
+        QCOMPARE(readBack.items, validXmlItems);
+    };
+};
+
+QTEST_MAIN(AbstractXmlFileTest)
+
+#include "AbstractXmlFileTest.moc"
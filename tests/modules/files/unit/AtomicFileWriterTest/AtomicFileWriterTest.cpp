@@ -0,0 +1,129 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+
+#include "draupnir/files/core/AtomicFileWriter.h"
+
+#include "draupnir-test/helpers/FileTestHelpers.h"
+
+using namespace Draupnir::Files;
+
+Q_DECLARE_METATYPE(Draupnir::Files::FileSyncPolicy)
+
+/*! @class AtomicFileWriterTest tests/modules/files/unit/AtomicFileWriterTest.cpp
+ *  @ingroup Files
+ *  @ingroup Tests
+ *  @brief Unit tests for @ref Draupnir::Files::AtomicFileWriter class. */
+
+class AtomicFileWriterTest : public QObject
+{
+    Q_OBJECT
+private:
+    const QByteArray oldData{"Old data"};
+    const QByteArray newData{"Completely new data"};
+
+    /*! @brief Returns `true` if no temporary files were left within the test directory. */
+    static bool noTemporaryFilesLeft() {
+        return QDir{FileTestHelper::tempDir().path()}.entryList({"*.tmp"}, QDir::Files | QDir::Hidden).isEmpty();
+    }
+
+private slots:
+    void initTestCase() {
+        QVERIFY(FileTestHelper::tempDir().isValid());
+    }
+
+    void test_write_new_file() {
+        const auto path = FileTestHelper::getTempFilePath("new_file.txt");
+        QVERIFY(path);
+
+        const auto result = AtomicFileWriter::write(path.value(), newData, {}, FileSyncPolicy::Data);
+        QVERIFY(result);
+        QCOMPARE(FileTestHelper::tempFileData(path.value()), newData);
+        QVERIFY(noTemporaryFilesLeft());
+    }
+
+    void test_overwrite_existing_file_data() {
+        QTest::addColumn<FileSyncPolicy>("syncPolicy");
+
+        QTest::newRow("None") << FileSyncPolicy::None;
+        QTest::newRow("Data") << FileSyncPolicy::Data;
+        QTest::newRow("Full") << FileSyncPolicy::Full;
+    }
+
+    void test_overwrite_existing_file() {
+        QFETCH(FileSyncPolicy, syncPolicy);
+
+        const auto path = FileTestHelper::createTempFile("existing_file.txt", oldData,
+            QFileDevice::ReadOwner | QFileDevice::WriteOwner | QFileDevice::ReadUser | QFileDevice::WriteUser);
+        QVERIFY(path);
+        const QFileDevice::Permissions permissions = QFileInfo{path.value()}.permissions();
+
+        const auto result = AtomicFileWriter::write(path.value(), newData, {}, syncPolicy);
+        QVERIFY(result);
+        QCOMPARE(FileTestHelper::tempFileData(path.value()), newData);
+        // Permissions of the replaced file are kept.
+        QCOMPARE(QFileInfo{path.value()}.permissions(), permissions);
+        QVERIFY(noTemporaryFilesLeft());
+    }
+
+    void test_read_only_file_is_not_replaced() {
+        const auto path = FileTestHelper::createTempFile("read_only_file.txt", oldData,
+            QFileDevice::ReadOwner | QFileDevice::ReadUser);
+        QVERIFY(path);
+
+        const auto result = AtomicFileWriter::write(path.value(), newData);
+        QCOMPARE(result.has_value(), false);
+        QCOMPARE(result.error().isEmpty(), false);
+        QCOMPARE(FileTestHelper::tempFileData(path.value()), oldData);
+        QVERIFY(noTemporaryFilesLeft());
+    }
+
+    void test_write_into_unreachable_directory() {
+        const auto dir = FileTestHelper::createTempDirectory("unreachable_dir", {});
+        QVERIFY(dir);
+
+        const auto result = AtomicFileWriter::write(QDir{dir.value()}.filePath("file.txt"), newData);
+        QCOMPARE(result.has_value(), false);
+        QCOMPARE(result.error().isEmpty(), false);
+    }
+
+    void test_write_through_symlink() {
+        const auto target = FileTestHelper::createTempFile("symlink_target.txt", oldData);
+        QVERIFY(target);
+        const auto link = FileTestHelper::getTempFilePath("symlink.txt");
+        QVERIFY(link);
+        if (!QFile::link(target.value(), link.value()))
+            QSKIP("Symbolic links are not supported.");
+
+        const auto result = AtomicFileWriter::write(link.value(), newData);
+        QVERIFY(result);
+        QVERIFY(QFileInfo{link.value()}.isSymLink());
+        QCOMPARE(FileTestHelper::tempFileData(target.value()), newData);
+    }
+};
+
+QTEST_MAIN(AtomicFileWriterTest)
+
+#include "AtomicFileWriterTest.moc"
@@ -0,0 +1,8 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+include(../../../../common/FileTestHelpers.pri)
+
+include(../../../../../modules/DraupnirFiles.pri)
+
+SOURCES += \
+    AtomicFileWriterTest.cpp
@@ -0,0 +1,97 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+
+#include "draupnir/files/core/ContentHasher.h"
+
+using namespace Draupnir::Files;
+
+/*! @class ContentHasherTest tests/modules/files/unit/ContentHasherTest.cpp
+ *  @ingroup Files
+ *  @ingroup Tests
+ *  @brief Unit tests for @ref Draupnir::Files::ContentHasher class. */
+
+class ContentHasherTest : public QObject
+{
+    Q_OBJECT
+private:
+    /*! @brief Returns 777 bytes long array, so all code paths of XXH64 are covered. */
+    static QByteArray longData() {
+        QByteArray result;
+        for (int repeat = 0; repeat < 3; repeat++) {
+            for (int i = 0; i < 256; i++)
+                result.append(static_cast<char>(i));
+        }
+        result.append("tail12345");
+        return result;
+    }
+
+private slots:
+    void test_reference_values_data() {
+        QTest::addColumn<QByteArray>("data");
+        QTest::addColumn<quint64>("expectedHash");
+
+        // Reference values produced by the original xxHash implementation.
+        QTest::newRow("empty")          << QByteArray{}                << quint64{0xEF46DB3751D8E999ULL};
+        QTest::newRow("one byte")       << QByteArray{"a"}             << quint64{0xD24EC4F1A98C6E5BULL};
+        QTest::newRow("three bytes")    << QByteArray{"abc"}           << quint64{0x44BC2CF5AD770999ULL};
+        QTest::newRow("fourteen bytes") << QByteArray{"VeryRandomData"} << quint64{0x2368D05F41F44FA3ULL};
+        QTest::newRow("long data")      << longData()                  << quint64{0xD67972C7A820D1CBULL};
+    }
+
+    void test_reference_values() {
+        QFETCH(QByteArray, data);
+        QFETCH(quint64, expectedHash);
+
+        QCOMPARE(ContentHasher::hash(data), expectedHash);
+    }
+
+    void test_chunked_hashing() {
+        const QByteArray data = longData();
+        const quint64 expectedHash = ContentHasher::hash(data);
+
+        for (int chunkSize : {1, 7, 31, 32, 33, 100}) {
+            ContentHasher hasher;
+            for (int offset = 0; offset < data.size(); offset += chunkSize)
+                hasher.addData(data.mid(offset, chunkSize));
+
+            QCOMPARE(hasher.size(), static_cast<qint64>(data.size()));
+            QCOMPARE(hasher.result(), expectedHash);
+        }
+    }
+
+    void test_reset() {
+        ContentHasher hasher;
+        hasher.addData(QByteArray{"Some data"});
+        hasher.reset();
+        hasher.addData(QByteArray{"abc"});
+
+        QCOMPARE(hasher.result(), quint64{0x44BC2CF5AD770999ULL});
+    }
+};
+
+QTEST_MAIN(ContentHasherTest)
+
+#include "ContentHasherTest.moc"
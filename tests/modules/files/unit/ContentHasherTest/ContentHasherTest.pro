@@ -0,0 +1,7 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+include(../../../../../modules/DraupnirFiles.pri)
+
+SOURCES += \
+    ContentHasherTest.cpp
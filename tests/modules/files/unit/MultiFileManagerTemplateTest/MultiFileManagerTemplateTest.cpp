@@ -0,0 +1,337 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+
+#include "draupnir/files/managers/MultiFileManagerTemplate.h"
+
+#include "draupnir-test/helpers/FileTestHelpers.h"
+#include "draupnir-test/mocks/DummyFiles.h"
+
+using Manager = Draupnir::Files::MultiFileManagerTemplate<DummyTextFile>;
+
+/*! @class MultiFileManagerTemplateTest tests/modules/files/unit/MultiFileManagerTemplateTest.cpp
+ *  @ingroup Files
+ *  @ingroup Tests
+ *  @brief Unit tests for @ref Draupnir::Files::MultiFileManagerTemplate class. */
+
+class MultiFileManagerTemplateTest : public QObject
+{
+    Q_OBJECT
+private:
+    const QByteArray firstFileData{"I am The File!."};
+    QString firstFilePath;
+
+    const QByteArray secondFileData{"VIF - Very Importat File"};
+    QString secondFilePath;
+
+    const QByteArray thirdFileData{"Third one"};
+    QString thirdFilePath;
+
+    Manager* manager = nullptr;
+    QSignalSpy* abstractCurrentFileChangedSignalSpy = nullptr;
+    QSignalSpy* fileEvictedSignalSpy = nullptr;
+
+private slots:
+    void initTestCase() {
+        QVERIFY(FileTestHelper::tempDir().isValid());
+
+        auto result = FileTestHelper::createTempFile("first_file.txt", firstFileData);
+        QVERIFY(result.has_value());
+        firstFilePath = result.value();
+
+        result = FileTestHelper::createTempFile("second_file.txt", secondFileData);
+        QVERIFY(result.has_value());
+        secondFilePath = result.value();
+
+        result = FileTestHelper::createTempFile("third_file.txt", thirdFileData);
+        QVERIFY(result.has_value());
+        thirdFilePath = result.value();
+    }
+
+    void init() {
+        manager = new Manager;
+        abstractCurrentFileChangedSignalSpy =
+            new QSignalSpy(manager, &Draupnir::Files::AbstractFileManager::currentAbstractFileChanged);
+        fileEvictedSignalSpy =
+            new QSignalSpy(manager, &Draupnir::Files::AbstractFileManager::fileEvicted);
+    }
+
+    void cleanup() {
+        delete fileEvictedSignalSpy;                fileEvictedSignalSpy = nullptr;
+        delete abstractCurrentFileChangedSignalSpy; abstractCurrentFileChangedSignalSpy = nullptr;
+        delete manager;                             manager = nullptr;
+    }
+
+    void test_initial_state() {
+        QCOMPARE(manager->currentFile(), nullptr);
+        QCOMPARE(manager->hasNothingOpened(), true);
+        QCOMPARE(manager->fileCount(), 0);
+        QCOMPARE(Manager::canHaveMultipleFilesOpened(), true);
+    }
+
+    void test_opening_files() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QVERIFY(manager->openFile(secondFilePath));
+        auto* secondFile = manager->currentFile();
+
+        QVERIFY(firstFile != secondFile);
+        QCOMPARE(secondFile->data, secondFileData);
+        QCOMPARE(manager->fileCount(), 2);
+        QCOMPARE(manager->files(), (QList<DummyTextFile*>{secondFile, firstFile}));
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 2);
+    }
+
+    void test_reopening_resident_file_is_cache_hit() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QVERIFY(manager->openFile(secondFilePath));
+        QVERIFY(manager->isResident(QFileInfo{firstFilePath}));
+
+        QVERIFY(manager->openFile(firstFilePath));
+        QCOMPARE(manager->currentFile(), firstFile);
+        QCOMPARE(manager->fileCount(), 2);
+        QCOMPARE(manager->files().first(), firstFile);
+    }
+
+    void test_least_recently_used_file_is_evicted() {
+        manager->setMaximumFileCount(2);
+
+        QVERIFY(manager->openFile(firstFilePath));
+        QVERIFY(manager->openFile(secondFilePath));
+        // First file becomes the most recently used one.
+        QVERIFY(manager->openFile(firstFilePath));
+        QVERIFY(manager->openFile(thirdFilePath));
+
+        QCOMPARE(manager->fileCount(), 2);
+        QVERIFY(manager->isResident(QFileInfo{firstFilePath}));
+        QVERIFY(!manager->isResident(QFileInfo{secondFilePath}));
+        QVERIFY(manager->isResident(QFileInfo{thirdFilePath}));
+        QCOMPARE(fileEvictedSignalSpy->count(), 1);
+        QCOMPARE(fileEvictedSignalSpy->first().first().value<QFileInfo>().absoluteFilePath(), secondFilePath);
+    }
+
+    void test_unsaved_files_are_not_evicted() {
+        manager->setMaximumFileCount(1);
+
+        QVERIFY(manager->openFile(firstFilePath));
+        manager->currentFile()->triggerUnsavedStatusChange(true);
+        manager->newFile();
+        QVERIFY(manager->openFile(secondFilePath));
+
+        // Modified and untitled files stay, even though the limit is exceeded.
+        QCOMPARE(manager->fileCount(), 3);
+        QVERIFY(manager->isResident(QFileInfo{firstFilePath}));
+        QCOMPARE(fileEvictedSignalSpy->count(), 0);
+        QCOMPARE(manager->hasUnsavedData(), true);
+
+        // Once saved and no longer current, the file can be evicted.
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QVERIFY(manager->openFile(secondFilePath));
+        fileEvictedSignalSpy->clear();
+        firstFile->triggerUnsavedStatusChange(false);
+        QVERIFY(!manager->isResident(QFileInfo{firstFilePath}));
+        QCOMPARE(fileEvictedSignalSpy->count(), 1);
+        QCOMPARE(fileEvictedSignalSpy->first().first().value<QFileInfo>().absoluteFilePath(), firstFilePath);
+    }
+
+    void test_memory_budget() {
+        // Only two of the files fit into the budget.
+        manager->setMemoryBudget(firstFileData.size() + secondFileData.size());
+
+        QVERIFY(manager->openFile(firstFilePath));
+        QVERIFY(manager->openFile(secondFilePath));
+        QCOMPARE(manager->fileCount(), 2);
+
+        QVERIFY(manager->openFile(thirdFilePath));
+        QVERIFY(!manager->isResident(QFileInfo{firstFilePath}));
+        QVERIFY(manager->estimatedMemoryUsage() <= manager->memoryBudget());
+    }
+
+    void test_close_current_file() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QVERIFY(manager->openFile(secondFilePath));
+        abstractCurrentFileChangedSignalSpy->clear();
+
+        manager->closeCurrentFile();
+        QCOMPARE(manager->currentFile(), firstFile);
+        QCOMPARE(manager->fileCount(), 1);
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 1);
+
+        manager->closeCurrentFile();
+        QCOMPARE(manager->currentFile(), nullptr);
+        QCOMPARE(manager->hasNothingOpened(), true);
+    }
+
+    void test_open_files() {
+        QCOMPARE(Manager::canOpenMultipleFilesAtOnce(), true);
+        manager->setBulkOpenThreadCount(2);
+
+        const QString missingFilePath = FileTestHelper::tempDir().path() + "/missing_dir/missing_file.txt";
+        const auto results = manager->openFiles(QStringList{firstFilePath, missingFilePath, secondFilePath, firstFilePath});
+
+        QCOMPARE(results.size(), 4);
+        QVERIFY(results.at(0).has_value());
+        QVERIFY(!results.at(1).has_value());
+        QVERIFY(results.at(2).has_value());
+        QVERIFY(results.at(3).has_value());
+
+        // Duplicates are read only once, the last resident file becomes current.
+        QCOMPARE(manager->fileCount(), 2);
+        QCOMPARE(manager->currentFile()->fileInfo().absoluteFilePath(), firstFilePath);
+        QCOMPARE(manager->currentFile()->data, firstFileData);
+        QCOMPARE(manager->currentFile()->hasUnsavedData(), false);
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 1);
+    }
+
+    void test_open_files_does_not_read_resident_files() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+
+        const auto results = manager->openFiles(QStringList{firstFilePath, secondFilePath, thirdFilePath});
+        QCOMPARE(results.size(), 3);
+        QCOMPARE(manager->fileCount(), 3);
+        QVERIFY(manager->files().contains(firstFile));
+        QCOMPARE(manager->currentFile()->data, thirdFileData);
+    }
+
+    void test_open_files_result_order() {
+        const QStringList filePaths{firstFilePath, secondFilePath, thirdFilePath};
+
+        QStringList deliveredInOrder;
+        manager->openFiles(filePaths, Draupnir::Files::ResultOrder::InOrder,
+            [&deliveredInOrder](const QFileInfo& fileInfo, const std::expected<void,QString>& result) {
+                QVERIFY(result.has_value());
+                deliveredInOrder.append(fileInfo.absoluteFilePath());
+            });
+        QCOMPARE(deliveredInOrder, filePaths);
+
+        delete abstractCurrentFileChangedSignalSpy; abstractCurrentFileChangedSignalSpy = nullptr;
+        delete fileEvictedSignalSpy;                fileEvictedSignalSpy = nullptr;
+        delete manager;
+        manager = new Manager;
+
+        QStringList deliveredAsCompleted;
+        manager->openFiles(filePaths, Draupnir::Files::ResultOrder::AsCompleted,
+            [this, &deliveredAsCompleted](const QFileInfo& fileInfo, const std::expected<void,QString>& result) {
+                QVERIFY(result.has_value());
+                // Handler is invoked after the file became resident.
+                QVERIFY(manager->isResident(fileInfo));
+                deliveredAsCompleted.append(fileInfo.absoluteFilePath());
+            });
+        deliveredAsCompleted.sort();
+        QStringList expected = filePaths;
+        expected.sort();
+        QCOMPARE(deliveredAsCompleted, expected);
+    }
+
+    void test_open_files_respects_maximum_file_count() {
+        manager->setBulkOpenThreadCount(1);
+        manager->setMaximumFileCount(2);
+
+        const auto results = manager->openFiles(QStringList{firstFilePath, secondFilePath, thirdFilePath});
+        QCOMPARE(results.size(), 3);
+        QCOMPARE(manager->fileCount(), 2);
+        QCOMPARE(manager->currentFile()->fileInfo().absoluteFilePath(), thirdFilePath);
+        QCOMPARE(fileEvictedSignalSpy->count(), 1);
+    }
+
+    void test_open_files_async() {
+        QSignalSpy fileOpenedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncFileOpened};
+        QSignalSpy finishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+        manager->setBulkOpenThreadCount(2);
+
+        const QString missingFilePath = FileTestHelper::tempDir().path() + "/missing_dir/missing_file.txt";
+        QVERIFY(manager->openFilesAsync(QStringList{secondFilePath, missingFilePath, firstFilePath, secondFilePath}));
+        QVERIFY(manager->isAsyncOperationRunning());
+        QVERIFY(!manager->openFilesAsync(QStringList{thirdFilePath}));
+
+        // Nothing is changed until the event loop runs.
+        QCOMPARE(manager->fileCount(), 0);
+
+        QVERIFY(finishedSpy.wait());
+        QVERIFY(!manager->isAsyncOperationRunning());
+        QCOMPARE(finishedSpy.first().at(0).toBool(), false);
+        QVERIFY(finishedSpy.first().at(1).toString().contains(missingFilePath));
+
+        // Every distinct file is reported once.
+        QCOMPARE(fileOpenedSpy.count(), 3);
+        int succeeded = 0;
+        for (const QList<QVariant>& arguments : std::as_const(fileOpenedSpy)) {
+            const bool isMissing = arguments.at(0).value<QFileInfo>().absoluteFilePath() == missingFilePath;
+            QCOMPARE(arguments.at(1).toBool(), !isMissing);
+            succeeded += arguments.at(1).toBool() ? 1 : 0;
+        }
+        QCOMPARE(succeeded, 2);
+
+        QCOMPARE(manager->fileCount(), 2);
+        QCOMPARE(manager->currentFile()->fileInfo().absoluteFilePath(), secondFilePath);
+        QCOMPARE(manager->currentFile()->data, secondFileData);
+        QCOMPARE(manager->currentFile()->hasUnsavedData(), false);
+    }
+
+    void test_open_files_async_reports_resident_files() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QSignalSpy finishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+
+        QVERIFY(manager->openFilesAsync(QStringList{firstFilePath, thirdFilePath}));
+        QVERIFY(finishedSpy.wait());
+        QCOMPARE(finishedSpy.first().at(0).toBool(), true);
+        QCOMPARE(manager->fileCount(), 2);
+        QVERIFY(manager->files().contains(firstFile));
+        QCOMPARE(manager->currentFile()->data, thirdFileData);
+    }
+
+    void test_close_current_file_after_cancelled_open_files_async() {
+        QVERIFY(manager->openFile(firstFilePath));
+        auto* firstFile = manager->currentFile();
+        QSignalSpy fileOpenedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncFileOpened};
+        QSignalSpy finishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+        manager->setBulkOpenThreadCount(1);
+
+        // Cancel once a file became resident in front of the current one.
+        QVERIFY(manager->openFilesAsync(QStringList{secondFilePath, thirdFilePath}));
+        QVERIFY(fileOpenedSpy.wait());
+        QCOMPARE(fileOpenedSpy.first().at(1).toBool(), true);
+        manager->cancelAsyncOperation();
+        QVERIFY(finishedSpy.count() > 0 || finishedSpy.wait());
+        QCOMPARE(finishedSpy.first().at(0).toBool(), false);
+        QCOMPARE(manager->currentFile(), firstFile);
+        QVERIFY(manager->files().first() != firstFile);
+
+        const int fileCount = manager->fileCount();
+        manager->closeCurrentFile();
+        QCOMPARE(manager->fileCount(), fileCount - 1);
+        QVERIFY(!manager->files().contains(firstFile));
+        QCOMPARE(manager->currentFile(), manager->files().first());
+    }
+};
+
+QTEST_MAIN(MultiFileManagerTemplateTest)
+
+#include "MultiFileManagerTemplateTest.moc"
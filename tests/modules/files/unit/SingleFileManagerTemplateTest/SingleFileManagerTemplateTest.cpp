@@ -147,6 +147,68 @@ private slots:
         QVERIFY(QFile::remove(nonExistingFile));
     }
 
+    void test_async_opening_file() {
+        QSignalSpy openFinishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+
+        QVERIFY(manager->openFileAsync(QFileInfo{firstFilePath}));
+        QVERIFY(manager->isAsyncOperationRunning());
+        // Second operation can not be started while first one is running.
+        QVERIFY(!manager->openFileAsync(QFileInfo{secondFilePath}));
+
+        QTRY_COMPARE(openFinishedSpy.count(), 1);
+        QCOMPARE(openFinishedSpy.first().at(0).toBool(), true);
+        QVERIFY(!manager->isAsyncOperationRunning());
+        QVERIFY(manager->currentFile() != nullptr);
+        QCOMPARE(manager->currentFile()->data, firstFileData);
+        QCOMPARE(manager->currentFileInfo().absoluteFilePath(), firstFilePath);
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 1);
+    }
+
+    void test_async_opening_file_failure() {
+        set_file_opened(firstFilePath);
+        auto* firstFile = manager->currentFile();
+        QSignalSpy openFinishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+
+        QVERIFY(manager->openFileAsync(QFileInfo{QDir{nonExistingFile}.filePath("no_such_dir/file.txt")}));
+
+        QTRY_COMPARE(openFinishedSpy.count(), 1);
+        QCOMPARE(openFinishedSpy.first().at(0).toBool(), false);
+        QCOMPARE(openFinishedSpy.first().at(1).toString().isEmpty(), false);
+        // Current file must stay untouched.
+        QCOMPARE(manager->currentFile(), firstFile);
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 0);
+    }
+
+    void test_async_opening_file_cancelled() {
+        QSignalSpy openFinishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncOpenFinished};
+
+        QVERIFY(manager->openFileAsync(QFileInfo{firstFilePath}));
+        manager->cancelAsyncOperation();
+
+        QTRY_COMPARE(openFinishedSpy.count(), 1);
+        QCOMPARE(openFinishedSpy.first().at(0).toBool(), false);
+        QCOMPARE(manager->currentFile(), nullptr);
+        QCOMPARE(abstractCurrentFileChangedSignalSpy->count(), 0);
+    }
+
+    void test_async_save_file() {
+        set_file_opened(secondFilePath);
+        manager->currentFile()->data = firstFileData;
+        manager->currentFile()->triggerUnsavedStatusChange(true);
+        QSignalSpy saveFinishedSpy{manager, &Draupnir::Files::AbstractFileManager::asyncSaveFinished};
+
+        QVERIFY(manager->saveCurrentFileAsync());
+
+        QTRY_COMPARE(saveFinishedSpy.count(), 1);
+        QCOMPARE(saveFinishedSpy.first().at(0).toBool(), true);
+        QCOMPARE(manager->hasUnsavedData(), false);
+        QCOMPARE(FileTestHelper::tempFileData(secondFilePath), firstFileData);
+
+        // Restore original contents for other tests.
+        manager->currentFile()->data = secondFileData;
+        QVERIFY(manager->saveCurrentFile());
+    }
+
     void test_close_file() {
         manager->newFile();
         abstractCurrentFileChangedSignalSpy->clear();
@@ -203,11 +203,61 @@ private slots:
         QCoreApplication::processEvents();
 
         int messagesSomewhere =
-                dummyLogger->m_messageGroupsMap[groupOne].count() +
-                dummyLogger->m_messageGroupsMap[groupTwo].count() +
+                dummyLogger->m_messageGroupsMap[groupOne]->count() +
+                dummyLogger->m_messageGroupsMap[groupTwo]->count() +
                 dummyHandler.messagesReceived.count();
         QCOMPARE(messagesSomewhere, totalMessageCount);
     }
+
+    void test_multithread_thread_local_groups_with_handler() {
+        constexpr int threadCount = 50;
+        constexpr int callCount = 100;
+        constexpr int totalMessageCount = threadCount * callCount;
+
+        dummyLogger->setMessageHandler(&dummyHandler);
+
+        // Each thread starts, fills and ends its own group, so appending goes through the thread-local buffers.
+        performSpamCalls(threadCount, 1, [this](){
+            const auto group = dummyLogger->beginMessageGroup();
+            for (int i = 0; i < callCount; i++)
+                dummyLogger->logDebug("debug", group);
+            dummyLogger->endMessageGroup(group);
+        });
+
+        QCOMPARE(dummyLogger->m_messageGroupsMap.count(), 0);
+        QTRY_COMPARE(dummyHandler.messagesReceived.count(), totalMessageCount);
+    }
+
+    void test_multithread_foreign_group_end_with_handler() {
+        constexpr int threadCount = 50;
+        constexpr int callCount = 100;
+
+        dummyLogger->setMessageHandler(&dummyHandler);
+
+        // Groups are started and filled by worker threads, while ended from this thread. Messages logged into the group
+        // after it was ended must be dropped and must not reappear anywhere.
+        QMutex groupsMutex;
+        QList<MessageGroup> groups;
+        performSpamCalls(threadCount, 1, [this,&groupsMutex,&groups](){
+            const auto group = dummyLogger->beginMessageGroup();
+            for (int i = 0; i < callCount; i++)
+                dummyLogger->logDebug("debug", group);
+            QMutexLocker locker{&groupsMutex};
+            groups.append(group);
+        });
+
+        for (const auto& group : groups)
+            dummyLogger->endMessageGroup(group);
+
+        QTRY_COMPARE(dummyHandler.messagesReceived.count(), threadCount * callCount);
+
+        performSpamCalls(threadCount, 1, [this,&groups](){
+            dummyLogger->logDebug("debug", groups.first());
+        });
+
+        QCoreApplication::processEvents();
+        QCOMPARE(dummyHandler.messagesReceived.count(), threadCount * callCount);
+    }
 };
 
 }; // namespace Draupnir::Logger
@@ -75,39 +75,39 @@ private slots:
         // As passing Message object from Logger to handler is done via signal / slot mechanism use QTRY_COMPARE here
         QTRY_COMPARE(dummyHandler.messagesReceived.count(), 1);
         // Here QCOMPARE would be ok
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 1);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 1);
     }
 
     void test_group_logging_without_handler() {
         // Create group
         auto group = dummyLogger->beginMessageGroup();
         QVERIFY(dummyLogger->isGroupExisting(group));
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
 
         // This message should go to p_tempMessageStorage
         dummyLogger->logDebug("text");
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(), 1);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
 
         // This message should go to p_tempMessageStorage
         dummyLogger->logDebug("brief", "what");
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
 
         // This should go to group
         dummyLogger->logDebug("group text", group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 1);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 1);
 
         // This should go to group as well
         dummyLogger->logDebug("group brief", "group what", group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 2);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 2);
 
         // Flush group. After flushing the group should be kept, while all Message from it - redirected to p_tempMessageStorage
         dummyLogger->flush(group);
         QVERIFY(dummyLogger->isGroupExisting(group));
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(), 4);
 
         // Log something to group and end the group
@@ -126,32 +126,32 @@ private slots:
         // Create group
         auto group = dummyLogger->beginMessageGroup();
         QVERIFY(dummyLogger->isGroupExisting(group));
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
 
         // This message should go directly to the handler
         dummyLogger->logDebug("text");
         QCOMPARE(dummyHandler.messagesReceived.count(), 1);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
 
         // This as well
         dummyLogger->logDebug("brief", "what");
         QCOMPARE(dummyHandler.messagesReceived.count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
 
         // This should go to group
         dummyLogger->logDebug("group text", group);
         QCOMPARE(dummyHandler.messagesReceived.count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 1);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 1);
 
         // This as well
         dummyLogger->logDebug("group brief", "group what", group);
         QCOMPARE(dummyHandler.messagesReceived.count(), 2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 2);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 2);
 
         // Flush group.
         dummyLogger->flush(group);
         QVERIFY(dummyLogger->isGroupExisting(group));
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(), 0);
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(), 0);
         QTRY_COMPARE(dummyHandler.messagesReceived.count(), 4);
 
         // Log something to group and end the group
@@ -161,6 +161,39 @@ private slots:
         QTRY_COMPARE(dummyHandler.messagesReceived.count(), 5);
     }
 
+    void test_sampled_logging() {
+        dummyLogger->setMessageHandler(&dummyHandler);
+
+        MessageSampler sampler = MessageSampler::oneIn(3);
+        for (int i = 0; i < 7; i++)
+            dummyLogger->logDebug(sampler, "sampled");
+
+        // Messages 0, 3 and 6 are emitted; the latter two report two suppressed messages each
+        QCOMPARE(dummyHandler.messagesReceived.count(), 3);
+        QVERIFY(dummyHandler.messagesReceived[0]->fields().isEmpty());
+        QCOMPARE(dummyHandler.messagesReceived[1]->fields().value(MessageSampler::suppressedFieldKey())->toInt64(), qint64{2});
+        QCOMPARE(dummyHandler.messagesReceived[2]->fields().value(MessageSampler::suppressedFieldKey())->toInt64(), qint64{2});
+        QCOMPARE(dummyHandler.messagesReceived[2]->type().level(), MessageLevel::Debug);
+    }
+
+    void test_sampled_logging_builds_text_only_for_emitted_messages() {
+        dummyLogger->setMessageHandler(&dummyHandler);
+
+        MessageSampler sampler = MessageSampler::oneIn(3);
+        int textsBuilt = 0;
+        for (int i = 0; i < 7; i++) {
+            dummyLogger->logDebug(sampler, [&textsBuilt, i]() {
+                textsBuilt++;
+                return QString{"sampled %1"}.arg(i);
+            });
+        }
+
+        QCOMPARE(textsBuilt, 3);
+        QCOMPARE(dummyHandler.messagesReceived.count(), 3);
+        QCOMPARE(dummyHandler.messagesReceived[1]->what(), QString{"sampled 3"});
+        QCOMPARE(dummyHandler.messagesReceived[1]->fields().value(MessageSampler::suppressedFieldKey())->toInt64(), qint64{2});
+    }
+
     void test_log_debug_method_group() {
         auto group = dummyLogger->beginMessageGroup();
         auto emptyGroup = dummyLogger->beginMessageGroup();
@@ -175,8 +208,8 @@ private slots:
         // Check if logDebug(const QString& text) is producing propper debug messages
         dummyLogger->logDebug(messageText);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),1);
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
         messagePtr = dummyLogger->p_tempMessageStorage->last();
         // Check if Message if what we expect
         // QCOMPARE(messagePtr->brief(), Draupnir::Messages::DebugMessageTrait::displayName());
@@ -186,8 +219,8 @@ private slots:
         // Check if logDebug(const QString& brief, const QString& what) is producing propper debug messages
         dummyLogger->logDebug(messageBrief,messageText);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
         messagePtr = dummyLogger->p_tempMessageStorage->last();
         // Check if Message if what we expect
         QCOMPARE(messagePtr->brief(), messageBrief);
@@ -197,9 +230,9 @@ private slots:
         // Check if logDebug(const QString& text, MessageGroup group) is producing propper debug messages
         dummyLogger->logDebug(messageText, group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(),1);
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
-        messagePtr = dummyLogger->m_messageGroupsMap[group].last();
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(),1);
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
+        messagePtr = dummyLogger->m_messageGroupsMap[group]->last();
         // Check if Message if what we expect
         // QCOMPARE(messagePtr->brief(), Draupnir::Messages::DebugMessageTrait::displayName());
         QCOMPARE(messagePtr->what(), messageText);
@@ -209,9 +242,9 @@ private slots:
         // messages
         dummyLogger->logDebug(messageBrief,messageText,group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(),2);
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
-        messagePtr = dummyLogger->m_messageGroupsMap[group].last();
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(),2);
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
+        messagePtr = dummyLogger->m_messageGroupsMap[group]->last();
         // Check if Message if what we expect
         QCOMPARE(messagePtr->brief(), messageBrief);
         QCOMPARE(messagePtr->what(), messageText);
@@ -235,8 +268,8 @@ private slots:
         // Check if logInfo(const QString& text) is producing propper info messages
         dummyLogger->logInfo(messageText);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),1);
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
         messagePtr = dummyLogger->p_tempMessageStorage->last();
         // Check if Message if what we expect
         // QCOMPARE(messagePtr->brief(), Draupnir::Messages::InfoMessageTrait::displayName());
@@ -246,8 +279,8 @@ private slots:
         // Check if logInfo(const QString& brief, const QString& what) is producing propper info messages
         dummyLogger->logInfo(messageBrief,messageText);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QVERIFY(dummyLogger->m_messageGroupsMap[group].isEmpty());
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[group]->isEmpty());
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
         messagePtr = dummyLogger->p_tempMessageStorage->last();
         // Check if Message if what we expect
         QCOMPARE(messagePtr->brief(), messageBrief);
@@ -257,9 +290,9 @@ private slots:
         // Check if logInfo(const QString& text, MessageGroup group) is producing propper info messages
         dummyLogger->logInfo(messageText,group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(),1);
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
-        messagePtr = dummyLogger->m_messageGroupsMap[group].last();
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(),1);
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
+        messagePtr = dummyLogger->m_messageGroupsMap[group]->last();
         // Check if Message if what we expect
         // QCOMPARE(messagePtr->brief(), Draupnir::Messages::InfoMessageTrait::displayName());
         QCOMPARE(messagePtr->what(), messageText);
@@ -269,9 +302,9 @@ private slots:
         // messages
         dummyLogger->logInfo(messageBrief,messageText,group);
         QCOMPARE(dummyLogger->p_tempMessageStorage->count(),2);
-        QCOMPARE(dummyLogger->m_messageGroupsMap[group].count(),2);
-        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup].isEmpty());
-        messagePtr = dummyLogger->m_messageGroupsMap[group].last();
+        QCOMPARE(dummyLogger->m_messageGroupsMap[group]->count(),2);
+        QVERIFY(dummyLogger->m_messageGroupsMap[emptyGroup]->isEmpty());
+        messagePtr = dummyLogger->m_messageGroupsMap[group]->last();
         // Check if Message if what we expect
         QCOMPARE(messagePtr->brief(), messageBrief);
         QCOMPARE(messagePtr->what(), messageText);
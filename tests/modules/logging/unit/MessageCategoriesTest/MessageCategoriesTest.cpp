@@ -0,0 +1,144 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+
+#include "draupnir/logging/messages/MessageCategories.h"
+
+namespace Draupnir::Logging
+{
+
+namespace {
+
+template<typename Category>
+concept CombinableWithOr = requires(Category lhs, Category rhs) { lhs | rhs; };
+
+template<typename Category>
+concept AssignableWithOr = requires(Category lhs, Category rhs) { lhs |= rhs; };
+
+}; // namespace
+
+/*! @class MessageCategoriesTest tests/modules/logging/unit/MessageCategoriesTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageCategory name registry and @ref Draupnir::Logging::MessageCategories. */
+
+class MessageCategoriesTest final : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_registry() {
+        QCOMPARE(MessageCategory::find("default"), std::optional<MessageCategory>{MessageCategory::Default});
+        QCOMPARE(MessageCategory{MessageCategory::Default}.name(), QLatin1String{"default"});
+
+        const MessageCategory custom = MessageCategory::FirstCustomCategory;
+        QVERIFY(MessageCategory::registerName(custom, "custom"));
+        QVERIFY(MessageCategory::registerName(custom, "custom"));
+        QVERIFY(MessageCategory::registerName(custom, "other") == false);
+        QVERIFY(MessageCategory::registerName(MessageCategory::nextType(custom), "custom") == false);
+
+        const MessageCategory network = MessageCategory::intern("network");
+        const MessageCategory storage = MessageCategory::intern("storage");
+        QCOMPARE(network.value(), quint32{MessageCategory::FirstInternedCategory});
+        QCOMPARE(storage, MessageCategory::nextType(network));
+        QCOMPARE(MessageCategory::intern("network"), network);
+        QCOMPARE(MessageCategory::find("storage"), std::optional<MessageCategory>{storage});
+        QCOMPARE(MessageCategory::find("never_registered"), std::optional<MessageCategory>{});
+        QCOMPARE(storage.name(), QLatin1String{"storage"});
+        QCOMPARE(MessageCategory{}.name(), QLatin1String{});
+    }
+
+    void test_interned_and_compile_time_categories_do_not_collide() {
+        // Declared at compile time, but never bound to a name.
+        static constexpr MessageCategory unnamed = MessageCategory::nextType(MessageCategory::FirstCustomCategory);
+        static constexpr MessageCategory named = MessageCategory::nextType(unnamed);
+        QVERIFY(MessageCategory::registerName(named, "mixed_named"));
+
+        const MessageCategory interned = MessageCategory::intern("mixed_interned");
+        QVERIFY(interned != unnamed);
+        QVERIFY(interned != named);
+        QVERIFY(interned.value() >= MessageCategory::FirstInternedCategory);
+
+        MessageCategories filter{unnamed};
+        QVERIFY(filter.test_flag(interned) == false);
+        filter.set_flag(interned, true);
+        filter.set_flag(unnamed, false);
+        QVERIFY(filter.test_flag(interned));
+        QVERIFY(filter.test_flag(unnamed) == false);
+
+        // Interned range can not be claimed by registerName.
+        QVERIFY(MessageCategory::registerName(MessageCategory{interned.value() + 1}, "mixed_stolen") == false);
+    }
+
+    void test_set_operations() {
+        MessageCategories categories;
+        QVERIFY(categories.none());
+        QVERIFY(categories == MessageCategories::None);
+
+        const MessageCategory small = 5;
+        const MessageCategory large = 1000;
+
+        categories.set_flag(small, true);
+        categories.set_flag(large, true);
+        QVERIFY(categories.test_flag(small));
+        QVERIFY(categories.test_flag(large));
+        QVERIFY(categories.test_flag(MessageCategory{999}) == false);
+        QVERIFY(categories.any());
+
+        categories.set_flag(large, false);
+        QVERIFY(categories.test_flag(large) == false);
+        QVERIFY(categories == MessageCategories{small});
+
+        const MessageCategories combined = MessageCategories{small} | MessageCategories{large};
+        QVERIFY(combined == (MessageCategories{small, large}));
+        QVERIFY(combined != MessageCategories{small});
+
+        // Categories are not bits, so two categories are combined only through MessageCategories.
+        static_assert(!CombinableWithOr<MessageCategory>);
+        static_assert(!AssignableWithOr<MessageCategory>);
+        QVERIFY((MessageCategories{small} | large) == combined);
+    }
+
+    void test_all_covers_new_categories() {
+        MessageCategories categories = MessageCategories::All;
+        const MessageCategory late = MessageCategory::intern("late_category_with_large_id");
+        QVERIFY(categories.test_flag(late));
+        QVERIFY(categories.test_flag(MessageCategory{100'000}));
+
+        categories.set_flag(MessageCategory{200}, false);
+        QVERIFY(categories.test_flag(MessageCategory{200}) == false);
+        QVERIFY(categories.test_flag(MessageCategory{100'000}));
+        QVERIFY(categories != MessageCategories::All);
+
+        categories.set_flag(MessageCategory{200}, true);
+        QVERIFY(categories == MessageCategories::All);
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageCategoriesTest)
+
+#include "MessageCategoriesTest.moc"
@@ -0,0 +1,170 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+
+#include "draupnir/logging/messages/Message.h"
+#include "draupnir/logging/messages/MessageFields.h"
+#include "draupnir/logging/messages/MessageViewItem.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageFieldsTest tests/modules/logging/unit/MessageFieldsTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageFields and related classes. */
+
+class MessageFieldsTest final : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_key_interning() {
+        const MessageFieldKey first = MessageFieldKey::intern("request_id");
+        const MessageFieldKey second = MessageFieldKey::intern("bytes");
+
+        QVERIFY(first);
+        QVERIFY(second);
+        QVERIFY(first != second);
+        QCOMPARE(MessageFieldKey::intern("request_id"), first);
+        QCOMPARE(MessageFieldKey::find("bytes"), std::optional<MessageFieldKey>{second});
+        QCOMPARE(MessageFieldKey::find("never_interned"), std::optional<MessageFieldKey>{});
+        QCOMPARE(first.name(), QLatin1String{"request_id"});
+        QCOMPARE(MessageFieldKey{}.name(), QLatin1String{});
+    }
+
+    void test_values() {
+        const MessageFieldValue intValue{42};
+        QCOMPARE(intValue.type(), MessageFieldValue::Int64);
+        QCOMPARE(intValue.toInt64(), qint64{42});
+        QCOMPARE(intValue.toDouble(), 42.0);
+        QVERIFY(intValue.isNumeric());
+        QCOMPARE(intValue.toString(), QString{"42"});
+
+        const MessageFieldValue doubleValue{1.5};
+        QCOMPARE(doubleValue.type(), MessageFieldValue::Double);
+        QCOMPARE(doubleValue.toDouble(), 1.5);
+        QVERIFY(doubleValue.isNumeric());
+
+        const MessageFieldValue boolValue{true};
+        QCOMPARE(boolValue.type(), MessageFieldValue::Bool);
+        QVERIFY(boolValue.toBool());
+        QVERIFY(boolValue.isNumeric() == false);
+        QCOMPARE(boolValue.toString(), QString{"true"});
+
+        const MessageFieldValue stringValue{"cache"};
+        QCOMPARE(stringValue.type(), MessageFieldValue::String);
+        QVERIFY(stringValue.toStringView() == "cache");
+        QCOMPARE(stringValue.toString(), QString{"cache"});
+        QVERIFY(stringValue.isNumeric() == false);
+
+        QVERIFY(intValue == MessageFieldValue{42});
+        QVERIFY((intValue == MessageFieldValue{42.0}) == false);
+        QVERIFY(stringValue == MessageFieldValue{std::string_view{"cache"}});
+    }
+
+    void test_storage() {
+        MessageFields fields;
+        QVERIFY(fields.isEmpty());
+        // First fields are stored inline, the heap pointer shares their space.
+        QCOMPARE(fields.capacity(), MessageFields::InlineCapacity);
+        QVERIFY(fields.isInline());
+        QVERIFY(sizeof(MessageFields) <= MessageFields::InlineCapacity * sizeof(MessageField) + 2 * sizeof(int));
+
+        // Fill the inline buffer, then go beyond it
+        for (int i = 0; i < MessageFields::InlineCapacity; i++)
+            fields.append(MessageFieldKey::intern(QByteArray::number(i).prepend("key_").toStdString()), i);
+        QVERIFY(fields.isInline());
+
+        const MessageFields inlineCopy = fields;
+        QVERIFY(inlineCopy.isInline());
+        QCOMPARE(inlineCopy.count(), MessageFields::InlineCapacity);
+
+        for (int i = MessageFields::InlineCapacity; i < MessageFields::InlineCapacity * 2 + 1; i++)
+            fields.append(MessageFieldKey::intern(QByteArray::number(i).prepend("key_").toStdString()), i);
+        QVERIFY(fields.isInline() == false);
+
+        QCOMPARE(fields.count(), MessageFields::InlineCapacity * 2 + 1);
+        int expected = 0;
+        for (const MessageField& field : fields)
+            QCOMPARE(field.value.toInt64(), qint64{expected++});
+
+        // Appending existing key replaces the value
+        const MessageFieldKey firstKey = MessageFieldKey::intern("key_0");
+        fields.append(firstKey, "replaced");
+        QCOMPARE(fields.count(), MessageFields::InlineCapacity * 2 + 1);
+        QVERIFY(fields.value(firstKey)->toStringView() == "replaced");
+
+        // Copies keep their own storage
+        const MessageFields copy = fields;
+        fields.append(MessageFieldKey::intern("key_extra"), 1);
+        QCOMPARE(copy.count(), MessageFields::InlineCapacity * 2 + 1);
+        QVERIFY(copy.contains(MessageFieldKey::intern("key_extra")) == false);
+        QVERIFY(copy.value(firstKey)->toStringView() == "replaced");
+
+        // Moved-from list is empty
+        MessageFields moved = std::move(fields);
+        QCOMPARE(moved.count(), MessageFields::InlineCapacity * 2 + 2);
+        QVERIFY(fields.isEmpty());
+        QVERIFY(fields.isInline());
+        QVERIFY(moved.value(firstKey)->toStringView() == "replaced");
+    }
+
+    void test_message_owns_field_strings() {
+        const MessageFieldKey pathKey = MessageFieldKey::intern("path");
+        const MessageFieldKey sizeKey = MessageFieldKey::intern("size");
+
+        std::string path = "/tmp/runtime/path";
+        Message* message = Message::create("Opened", MessageFields{{pathKey, std::string_view{path}}, {sizeKey, 42}}, MessageLevel::Info);
+        path.assign(path.size(), 'x');
+        path.clear();
+        path.shrink_to_fit();
+
+        QVERIFY(message->fields().value(pathKey)->toStringView() == "/tmp/runtime/path");
+        QCOMPARE(message->fields().value(sizeKey)->toInt64(), qint64{42});
+        delete message;
+    }
+
+    void test_message_fields_rendering() {
+        const MessageFieldKey requestKey = MessageFieldKey::intern("request_id");
+        const MessageFieldKey cachedKey = MessageFieldKey::intern("cached");
+
+        Message* message = Message::create("brief", "what", MessageFields{{requestKey, 7}, {cachedKey, false}}, MessageLevel::Info);
+        QCOMPARE(message->fields().count(), 2);
+        QCOMPARE(message->fields().value(requestKey)->toInt64(), qint64{7});
+
+        MessageViewItem item{message};
+        QCOMPARE(item.getViewString(MessageViewItemField::What), QString{"what\nrequest_id=7, cached=false"});
+        QCOMPARE(item.getViewString(MessageViewItemField::Brief), QString{"brief"});
+
+        delete message;
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageFieldsTest)
+
+#include "MessageFieldsTest.moc"
@@ -0,0 +1,124 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <QtTest>
+#include <QtConcurrent>
+
+#include "draupnir/logging/core/MessageGroupBuffer.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageGroupBufferTest tests/modules/logging/unit/MessageGroupBufferTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageGroupBuffer class. */
+
+class MessageGroupBufferTest final : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_append_and_take() {
+        MessageGroupBuffer buffer;
+        QVERIFY(buffer.isEmpty());
+        QVERIFY(buffer.isClosed() == false);
+        QVERIFY(buffer.takeChain() == nullptr);
+
+        Message* first = Message::create("first", MessageLevel::Debug);
+        Message* second = Message::create("second", MessageLevel::Info);
+        QVERIFY(buffer.append(first));
+        QVERIFY(buffer.append(second));
+        QCOMPARE(buffer.count(), 2);
+        QCOMPARE(buffer.last(), second);
+
+        // Messages should be returned in the order they were appended
+        const MessageList messages = MessageGroupBuffer::toMessageList(buffer.takeChain());
+        QCOMPARE(messages, (MessageList{first, second}));
+        QVERIFY(buffer.isEmpty());
+        QVERIFY(buffer.isClosed() == false);
+
+        // Buffer should remain usable after taking messages
+        Message* third = Message::create("third", MessageLevel::Debug);
+        QVERIFY(buffer.append(third));
+        QCOMPARE(buffer.count(), 1);
+
+        qDeleteAll(messages);
+    }
+
+    void test_close() {
+        MessageGroupBuffer buffer;
+
+        Message* first = Message::create("first", MessageLevel::Debug);
+        QVERIFY(buffer.append(first));
+
+        const MessageList messages = MessageGroupBuffer::toMessageList(buffer.closeChain());
+        QCOMPARE(messages, (MessageList{first}));
+        QVERIFY(buffer.isClosed());
+        QVERIFY(buffer.isEmpty());
+        QCOMPARE(buffer.count(), 0);
+
+        // Closed buffer rejects messages, ownership stays with the caller
+        Message* rejected = Message::create("rejected", MessageLevel::Debug);
+        QVERIFY(buffer.append(rejected) == false);
+        QVERIFY(buffer.takeChain() == nullptr);
+        QVERIFY(buffer.closeChain() == nullptr);
+
+        delete rejected;
+        qDeleteAll(messages);
+    }
+
+    void test_concurrent_append() {
+        constexpr int threadCount = 20;
+        constexpr int callCount = 1000;
+
+        MessageGroupBuffer buffer;
+        QList<QFuture<void>> futureList;
+        int taken = 0;
+
+        for (int i = 0; i < threadCount; i++) {
+            futureList.append(QtConcurrent::run([&buffer](){
+                for (int j = 0; j < callCount; j++)
+                    buffer.append(Message::create("text", MessageLevel::Debug));
+            }));
+        }
+
+        // Take messages concurrently with appending to be sure nothing is lost
+        while (taken < threadCount * callCount) {
+            const MessageList messages = MessageGroupBuffer::toMessageList(buffer.takeChain());
+            taken += messages.count();
+            qDeleteAll(messages);
+        }
+
+        for (auto& future : futureList)
+            future.waitForFinished();
+
+        QCOMPARE(taken, threadCount * callCount);
+        QVERIFY(buffer.isEmpty());
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageGroupBufferTest)
+
+#include "MessageGroupBufferTest.moc"
@@ -0,0 +1,11 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+QT += widgets concurrent
+
+DEFINES += DRAUPNIR_SETTINGS_USE_CUSTOM
+
+include(../../../../../modules/Logging.pri)
+
+SOURCES +=  \
+    MessageGroupBufferTest.cpp
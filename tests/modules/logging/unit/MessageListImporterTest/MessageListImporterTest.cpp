@@ -0,0 +1,116 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+#include <QTemporaryFile>
+
+#include "draupnir/logging/core/AbstractMessageViewIconProvider.h"
+#include "draupnir/logging/messages/MessageViewItem.h"
+#include "draupnir/logging/models/MessageListImporter.h"
+#include "draupnir/logging/models/MessageListModel.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageListImporterTest tests/modules/logging/unit/MessageListImporterTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageListImporter class. */
+
+class MessageListImporterTest final : public QObject
+{
+    Q_OBJECT
+private:
+    AbstractMessageViewIconProvider iconProvider;
+
+    static constexpr int messageCount = 25;
+
+    /*! @brief Writes `messageCount` messages into `file`. */
+    void writeMessages(QTemporaryFile& file, MessageStreamFormat format) {
+        QVERIFY(file.open());
+        MessageStreamWriter writer{&file, format};
+        for (int i = 0; i < messageCount; i++) {
+            Message* message = Message::create(QString::number(i), MessageLevel::Info);
+            QVERIFY(writer.write(*message).has_value());
+            delete message;
+        }
+        file.close();
+    }
+
+private slots:
+    void initTestCase() { MessageViewItem::registerIconProvider(&iconProvider); }
+
+    void test_import_data() {
+        QTest::addColumn<int>("format");
+        QTest::newRow("JsonLines") << static_cast<int>(MessageStreamFormat::JsonLines);
+        QTest::newRow("Binary")    << static_cast<int>(MessageStreamFormat::Binary);
+    }
+
+    void test_import() {
+        QFETCH(int, format);
+        const MessageStreamFormat streamFormat = static_cast<MessageStreamFormat>(format);
+
+        QTemporaryFile file;
+        writeMessages(file, streamFormat);
+
+        MessageListModel model;
+        MessageListImporter importer{&model};
+        importer.setChunkSize(10);
+
+        QSignalSpy progressSpy{&importer, &MessageListImporter::progressChanged};
+        QSignalSpy finishedSpy{&importer, &MessageListImporter::finished};
+
+        QVERIFY(importer.start(file.fileName(), streamFormat));
+        QVERIFY(importer.isRunning());
+        QVERIFY(importer.start(file.fileName(), streamFormat) == false);
+
+        QTRY_COMPARE(finishedSpy.count(), 1);
+        QCOMPARE(finishedSpy.first().at(0).toBool(), true);
+        QVERIFY(importer.isRunning() == false);
+
+        QCOMPARE(model.rowCount(), messageCount);
+        QCOMPARE(model.index(messageCount - 1, 0).data().toString().startsWith(QString::number(messageCount - 1)), true);
+
+        QCOMPARE(progressSpy.count(), 3);
+        QCOMPARE(progressSpy.last().at(0).toLongLong(), file.size());
+    }
+
+    void test_missing_file() {
+        MessageListModel model;
+        MessageListImporter importer{&model};
+        QSignalSpy finishedSpy{&importer, &MessageListImporter::finished};
+
+        QVERIFY(importer.start("/this/file/does/not/exist", MessageStreamFormat::JsonLines));
+        QTRY_COMPARE(finishedSpy.count(), 1);
+        QCOMPARE(finishedSpy.first().at(0).toBool(), false);
+        QCOMPARE(model.rowCount(), 0);
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageListImporterTest)
+
+#include "MessageListImporterTest.moc"
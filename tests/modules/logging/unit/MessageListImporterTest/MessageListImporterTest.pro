@@ -0,0 +1,12 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+QT += widgets
+
+DEFINES += DRAUPNIR_SETTINGS_USE_CUSTOM
+DEFINES += DRAUPNIR_LOGGING_SINGLETHREAD
+
+include(../../../../../modules/Logging.pri)
+
+SOURCES +=  \
+    MessageListImporterTest.cpp
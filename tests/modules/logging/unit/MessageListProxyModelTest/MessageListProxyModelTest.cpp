@@ -42,8 +42,8 @@ class MessageListProxyModelTest : public QObject
 {
     Q_OBJECT
 private:
-    static inline constexpr MessageCategory dummyCategory       = 0b1000'0000'0000'0000;
-    static inline constexpr MessageCategory nonExistingCategory = 0b0001'0000'0000'0000;
+    static inline constexpr MessageCategory dummyCategory       = MessageCategory::nextType(MessageCategory::FirstCustomCategory);
+    static inline constexpr MessageCategory nonExistingCategory = MessageCategory::nextType(dummyCategory);
 
     MessageListModel* sourceModel = nullptr;
     Message* debugOne = nullptr;
@@ -191,6 +191,55 @@ private slots:
                  message->getViewString(testedProxy->displayedMessageViewItemFieldsMask()));
     }
 
+    void test_message_field_filter_and_aggregate() {
+        const MessageFieldKey durationKey = MessageFieldKey::intern("duration_ms");
+        const MessageFieldKey sourceKey = MessageFieldKey::intern("source");
+
+        MessageListModel fieldsModel;
+        fieldsModel.append({
+            Message::create("fast", MessageFields{{durationKey, 5}, {sourceKey, "cache"}}, MessageLevel::Info),
+            Message::create("slow", MessageFields{{durationKey, 250.5}, {sourceKey, "disk"}}, MessageLevel::Info),
+            Message::create("slower", MessageFields{{durationKey, 1000}}, MessageLevel::Warning),
+            Message::create("no fields", MessageLevel::Info)
+        });
+        testedProxy->setSourceModel(&fieldsModel);
+
+        // Aggregate over all numeric values
+        auto aggregate = testedProxy->aggregateMessageField(durationKey);
+        QCOMPARE(aggregate.count, 3);
+        QCOMPARE(aggregate.sum, 1255.5);
+        QCOMPARE(aggregate.min, 5.0);
+        QCOMPARE(aggregate.max, 1000.0);
+
+        // Non-numeric fields are not aggregated
+        QCOMPARE(testedProxy->aggregateMessageField(sourceKey).count, 0);
+
+        // Filter by numeric field
+        testedProxy->setMessageFieldFilter(durationKey, [](const MessageFieldValue& value){
+            return value.toDouble() > 100;
+        });
+        QVERIFY(testedProxy->hasMessageFieldFilter());
+        QCOMPARE(testedProxy->rowCount(), 2);
+        aggregate = testedProxy->aggregateMessageField(durationKey);
+        QCOMPARE(aggregate.count, 2);
+        QCOMPARE(aggregate.min, 250.5);
+
+        // Filter by string field. Messages without the field are filtered out.
+        testedProxy->setMessageFieldFilter(sourceKey, [](const MessageFieldValue& value){
+            return value.toStringView() == "cache";
+        });
+        QCOMPARE(testedProxy->rowCount(), 1);
+
+        // Field filter is combined with the level filter
+        testedProxy->clearMessageFieldFilter();
+        QVERIFY(testedProxy->hasMessageFieldFilter() == false);
+        testedProxy->setDisplayedMessageLevelsMask(MessageLevel::Warning);
+        QCOMPARE(testedProxy->rowCount(), 1);
+        QCOMPARE(testedProxy->aggregateMessageField(durationKey).sum, 1000.0);
+
+        testedProxy->setSourceModel(nullptr);
+    }
+
     void test_setting_message_levels_extended() {
         // Test multiple disabling calls
         testedProxy->setMessageLevelDisplayed(MessageLevel::Debug, false);
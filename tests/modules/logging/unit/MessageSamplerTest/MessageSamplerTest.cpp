@@ -0,0 +1,87 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+
+#include "draupnir/logging/core/MessageSampler.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageSamplerTest tests/modules/logging/unit/MessageSamplerTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageSampler class. */
+
+class MessageSamplerTest final : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_one_in() {
+        MessageSampler sampler = MessageSampler::oneIn(4);
+
+        QCOMPARE(sampler.sample(), std::optional<quint64>{0});
+        for (int i = 0; i < 3; i++)
+            QCOMPARE(sampler.sample(), std::optional<quint64>{});
+        QCOMPARE(sampler.suppressedCount(), quint64{3});
+
+        QCOMPARE(sampler.sample(), std::optional<quint64>{3});
+        QCOMPARE(sampler.suppressedCount(), quint64{0});
+    }
+
+    void test_one_in_one_accepts_everything() {
+        MessageSampler sampler = MessageSampler::oneIn(1);
+        for (int i = 0; i < 10; i++)
+            QCOMPARE(sampler.sample(), std::optional<quint64>{0});
+    }
+
+    void test_per_second() {
+        using namespace std::chrono_literals;
+
+        MessageSampler sampler = MessageSampler::perSecond(2);
+        const MessageSampler::Clock::time_point start = MessageSampler::Clock::now();
+
+        QCOMPARE(sampler.sample(start), std::optional<quint64>{0});
+        QCOMPARE(sampler.sample(start + 100ms), std::optional<quint64>{0});
+        QCOMPARE(sampler.sample(start + 200ms), std::optional<quint64>{});
+        QCOMPARE(sampler.sample(start + 900ms), std::optional<quint64>{});
+
+        // New one-second window starts
+        QCOMPARE(sampler.sample(start + 1000ms), std::optional<quint64>{2});
+        QCOMPARE(sampler.sample(start + 1100ms), std::optional<quint64>{0});
+        QCOMPARE(sampler.sample(start + 1200ms), std::optional<quint64>{});
+    }
+
+    void test_suppressed_field_key() {
+        QVERIFY(MessageSampler::suppressedFieldKey());
+        QCOMPARE(MessageSampler::suppressedFieldKey().name(), QLatin1String{"suppressed"});
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageSamplerTest)
+
+#include "MessageSamplerTest.moc"
@@ -0,0 +1,124 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QBuffer>
+#include <QCoreApplication>
+
+#include "draupnir/logging/core/MessageStream.h"
+
+namespace Draupnir::Logging
+{
+
+/*! @class MessageStreamTest tests/modules/logging/unit/MessageStreamTest.cpp
+ *  @ingroup LoggingTests
+ *  @brief Unit test for @ref Draupnir::Logging::MessageStreamWriter and @ref Draupnir::Logging::MessageStreamReader classes. */
+
+class MessageStreamTest final : public QObject
+{
+    Q_OBJECT
+private slots:
+    void test_round_trip_data() {
+        QTest::addColumn<int>("format");
+        QTest::newRow("JsonLines") << static_cast<int>(MessageStreamFormat::JsonLines);
+        QTest::newRow("Binary")    << static_cast<int>(MessageStreamFormat::Binary);
+    }
+
+    void test_round_trip() {
+        QFETCH(int, format);
+        const MessageStreamFormat streamFormat = static_cast<MessageStreamFormat>(format);
+
+        const MessageCategory networkCategory = MessageCategory::intern("stream_test_network");
+        const MessageFieldKey bytesKey = MessageFieldKey::intern("bytes");
+        const MessageFieldKey hostKey = MessageFieldKey::intern("host");
+        const MessageFieldKey ratioKey = MessageFieldKey::intern("ratio");
+        const MessageFieldKey cachedKey = MessageFieldKey::intern("cached");
+
+        MessageList original;
+        original.append(Message::create("plain", MessageLevel::Debug));
+        original.append(Message::create("brief", "what", MessageFields{
+            {bytesKey, qint64{9'007'199'254'740'993}},
+            {hostKey, "example.org"},
+            {ratioKey, 0.25},
+            {cachedKey, true}
+        }, MessageLevel::Warning, networkCategory));
+
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        MessageStreamWriter writer{&buffer, streamFormat};
+        for (const Message* message : original)
+            QVERIFY(writer.write(*message).has_value());
+        buffer.close();
+
+        QVERIFY(buffer.open(QIODevice::ReadOnly));
+        MessageStreamReader reader{&buffer, streamFormat};
+        std::expected<MessageList,QString> first = reader.readChunk(1);
+        QVERIFY(first.has_value());
+        QCOMPARE(first->count(), 1);
+        std::expected<MessageList,QString> rest = reader.readChunk(10);
+        QVERIFY(rest.has_value());
+        QCOMPARE(rest->count(), 1);
+        QVERIFY(reader.atEnd());
+
+        const MessageList restored = first.value() + rest.value();
+        for (int i = 0; i < original.count(); i++) {
+            QCOMPARE(restored[i]->type().level(), original[i]->type().level());
+            QCOMPARE(restored[i]->type().category(), original[i]->type().category());
+            QCOMPARE(restored[i]->brief(), original[i]->brief());
+            QCOMPARE(restored[i]->what(), original[i]->what());
+            QCOMPARE(restored[i]->dateTime().toMSecsSinceEpoch(), original[i]->dateTime().toMSecsSinceEpoch());
+            QCOMPARE(restored[i]->fields().count(), original[i]->fields().count());
+            for (const MessageField& field : original[i]->fields()) {
+                QVERIFY(restored[i]->fields().contains(field.key));
+                QVERIFY(*restored[i]->fields().value(field.key) == field.value);
+            }
+        }
+
+        qDeleteAll(original);
+        qDeleteAll(restored);
+    }
+
+    void test_corrupted_input() {
+        QByteArray data{"{\"l\":1,\"w\":\"ok\"}\nnot a json\n"};
+        QBuffer buffer{&data};
+        QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+        MessageStreamReader reader{&buffer, MessageStreamFormat::JsonLines};
+        QVERIFY(reader.readChunk(10).has_value() == false);
+
+        QByteArray binaryData{"garbage"};
+        QBuffer binaryBuffer{&binaryData};
+        QVERIFY(binaryBuffer.open(QIODevice::ReadOnly));
+
+        MessageStreamReader binaryReader{&binaryBuffer, MessageStreamFormat::Binary};
+        QVERIFY(binaryReader.readChunk(10).has_value() == false);
+    }
+};
+
+}; // namespace Draupnir::Logging
+
+QTEST_MAIN(Draupnir::Logging::MessageStreamTest)
+
+#include "MessageStreamTest.moc"
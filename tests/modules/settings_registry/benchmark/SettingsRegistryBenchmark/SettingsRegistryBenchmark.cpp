@@ -0,0 +1,189 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "draupnir/settings_registry/SettingsRegistryTemplate.h"
+#include "draupnir/settings_registry/core/BinarySettingsBackend.h"
+#include "draupnir/settings_registry/core/InMemorySettingsBackend.h"
+
+using namespace Draupnir::Settings;
+
+/*! @brief Integer setting trait with generated key `benchmark/NNNN`. */
+template<std::size_t Index>
+struct BenchmarkSettingTrait
+{
+    static_assert(Index < 10000, "Index must fit into four digits of the key.");
+
+    using Value = int;
+
+    static constexpr std::array<char,14> keyStorage = []() {
+        std::array<char,14> result{'b','e','n','c','h','m','a','r','k','/','0','0','0','0'};
+        std::size_t value = Index;
+        for (std::size_t i = result.size() - 1; i >= 10; i--) {
+            result[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        return result;
+    }();
+
+    static constexpr std::string_view keyView() { return std::string_view{keyStorage.data(), keyStorage.size()}; }
+    static int defaultValue() { return -1; }
+};
+
+template<std::size_t... Indices>
+auto _makeBenchmarkRegistry(std::index_sequence<Indices...>) -> SettingsRegistryTemplate<BenchmarkSettingTrait<Indices>...>;
+
+/*! @brief SettingsRegistryTemplate with `Count` integer traits. */
+template<std::size_t Count>
+using BenchmarkRegistry = decltype(_makeBenchmarkRegistry(std::make_index_sequence<Count>{}));
+
+/*! @class SettingsRegistryBenchmark tests/modules/settings_registry/benchmark/SettingsRegistryBenchmark/SettingsRegistryBenchmark.cpp
+ *  @ingroup SettingsRegistryTests
+ *  @brief This class measures cost of the main operations of the @ref Draupnir::Settings::SettingsRegistryTemplate:
+ *         loading all settings, setting values and creating bundles, for registries of different sizes and with
+ *         different backends. */
+
+class SettingsRegistryBenchmark final : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr std::size_t maximalTraitCount = 1000;
+
+    InMemorySettingsBackend inMemoryBackend;
+    QTemporaryDir tempDir;
+    std::unique_ptr<BinarySettingsBackend> binaryBackend;
+
+private slots:
+    void initTestCase() {
+        QVERIFY(tempDir.isValid());
+        binaryBackend = std::make_unique<BinarySettingsBackend>(tempDir.filePath("settings.bin"));
+        QVERIFY(binaryBackend->load().has_value());
+
+        // Every trait has a stored value, so loading reads real data instead of falling back to defaults.
+        _populate(std::make_index_sequence<maximalTraitCount>{});
+        QCOMPARE(inMemoryBackend.count(), static_cast<int>(maximalTraitCount));
+        QVERIFY(binaryBackend->commit().has_value());
+        QCOMPARE(binaryBackend->count(), static_cast<int>(maximalTraitCount));
+    }
+
+    void benchmark_loadSettings_10()   { _benchmarkLoad<10>(&inMemoryBackend); }
+    void benchmark_loadSettings_100()  { _benchmarkLoad<100>(&inMemoryBackend); }
+    void benchmark_loadSettings_1000() { _benchmarkLoad<1000>(&inMemoryBackend); }
+
+    void benchmark_loadSettings_10_binary()   { _benchmarkLoad<10>(binaryBackend.get()); }
+    void benchmark_loadSettings_100_binary()  { _benchmarkLoad<100>(binaryBackend.get()); }
+    void benchmark_loadSettings_1000_binary() { _benchmarkLoad<1000>(binaryBackend.get()); }
+
+    void benchmark_set() {
+        BenchmarkRegistry<100> registry;
+        registry.setBackend(&inMemoryBackend);
+
+        int value = 0;
+        QBENCHMARK {
+            registry.template set<BenchmarkSettingTrait<42>>(value++);
+        }
+        QCOMPARE(registry.template get<BenchmarkSettingTrait<42>>(), value - 1);
+    }
+
+    void benchmark_set_binary() {
+        BenchmarkRegistry<100> registry;
+        registry.setBackend(binaryBackend.get());
+
+        int value = 0;
+        QBENCHMARK {
+            registry.template set<BenchmarkSettingTrait<42>>(value++);
+        }
+        QCOMPARE(registry.template get<BenchmarkSettingTrait<42>>(), value - 1);
+    }
+
+    void benchmark_set_writeBehind() {
+        BenchmarkRegistry<100> registry;
+        registry.setBackend(&inMemoryBackend);
+        registry.setWriteBehindEnabled(true);
+
+        int value = 0;
+        QBENCHMARK {
+            registry.template set<BenchmarkSettingTrait<42>>(value++);
+        }
+        registry.commit();
+        QCOMPARE(inMemoryBackend.value(SettingTraitKey<BenchmarkSettingTrait<42>>::qString()).toInt(), value - 1);
+    }
+
+    void benchmark_getSettingsBundle_1000() {
+        BenchmarkRegistry<1000> registry;
+        registry.setBackend(&inMemoryBackend);
+
+        QBENCHMARK {
+            auto bundle = registry.template getSettingBundleForTraits<
+                BenchmarkSettingTrait<0>,
+                BenchmarkSettingTrait<111>,
+                BenchmarkSettingTrait<222>,
+                BenchmarkSettingTrait<333>,
+                BenchmarkSettingTrait<444>,
+                BenchmarkSettingTrait<555>,
+                BenchmarkSettingTrait<666>,
+                BenchmarkSettingTrait<777>,
+                BenchmarkSettingTrait<888>,
+                BenchmarkSettingTrait<999>
+            >();
+            Q_UNUSED(bundle);
+        }
+    }
+
+    void cleanupTestCase() {
+        binaryBackend.reset();
+    }
+
+private:
+    template<std::size_t... Indices>
+    void _populate(std::index_sequence<Indices...>) {
+        (inMemoryBackend.setValue(SettingTraitKey<BenchmarkSettingTrait<Indices>>::qString(), int{Indices}), ...);
+        (binaryBackend->setInt64(SettingTraitKey<BenchmarkSettingTrait<Indices>>::qString(), qint64{Indices}), ...);
+    }
+
+    template<std::size_t Count>
+    void _benchmarkLoad(SettingsBackendInterface* backend) {
+        QBENCHMARK {
+            BenchmarkRegistry<Count> registry;
+            registry.setBackend(backend);
+        }
+
+        BenchmarkRegistry<Count> registry;
+        registry.setBackend(backend);
+        QCOMPARE(registry.template get<BenchmarkSettingTrait<Count - 1>>(), static_cast<int>(Count - 1));
+    }
+};
+
+QTEST_MAIN(SettingsRegistryBenchmark)
+
+#include "SettingsRegistryBenchmark.moc"
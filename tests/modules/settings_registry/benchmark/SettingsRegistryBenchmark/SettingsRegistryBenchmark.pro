@@ -0,0 +1,13 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+DEFINES += DRAUPNIR_SETTINGS_USE_CUSTOM
+
+# Registries with 1000 traits are instantiated within this benchmark. Their settings are kept in a std::tuple, which is
+# implemented recursively by the standard library, so it exceeds the default template instantiation depth.
+gcc|clang: QMAKE_CXXFLAGS += -ftemplate-depth=2048
+
+include(../../../../../modules/SettingsRegistry.pri)
+
+SOURCES +=  \
+    SettingsRegistryBenchmark.cpp
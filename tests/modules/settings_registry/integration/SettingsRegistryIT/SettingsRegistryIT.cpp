@@ -24,6 +24,7 @@
 
 #include <QtTest>
 #include <QCoreApplication>
+#include <QTemporaryDir>
 
 #include "draupnir-test/mocks/SettingsBackendMockTemplate.h"
 #include "draupnir-test/traits/settings/DoubleSettingTraits.h"
@@ -32,6 +33,9 @@
 #include "draupnir-test/traits/settings/ComplexValueSettingTrait.h"
 
 #include "draupnir/settings_registry/SettingsRegistryTemplate.h"
+#include "draupnir/settings_registry/core/BinarySettingsBackend.h"
+#include "draupnir/settings_registry/traits/settings/files/LastUsedDirectorySetting.h"
+#include "draupnir/settings_registry/traits/settings/files/RecentFilesListSetting.h"
 
 /*! @class SettingsRegistryIT tests/modules/settings_registry/integration/SettingsRegistryIT/SettingsRegistryIT.cpp
  *  @ingroup SettingsRegistryTests
@@ -180,6 +184,296 @@ private slots:
         QCOMPARE(mockedBackend.getQVariant<ComplexValueSettingTrait>(), valueVariant);
 
     }
+
+    void test_constexpr_keys() {
+        using Draupnir::Settings::LastUsedDirectorySetting;
+        using Draupnir::Settings::RecentFileListSetting;
+        using ConstexprKeysRegistry = Draupnir::Settings::SettingsRegistryTemplate<
+            RecentFileListSetting,
+            LastUsedDirectorySetting
+        >;
+
+        static_assert(!SettingsRegistry::hasConstexprKeys());
+        static_assert(ConstexprKeysRegistry::hasConstexprKeys());
+        static_assert(ConstexprKeysRegistry::indexOfKey("files/recent_files") == 0);
+        static_assert(ConstexprKeysRegistry::indexOfKey("files/last_used_directory") == 1);
+        static_assert(!ConstexprKeysRegistry::indexOfKey("files/unknown").has_value());
+
+        QCOMPARE(Draupnir::Settings::SettingTraitKey<RecentFileListSetting>::qString(), QString{"files/recent_files"});
+        QCOMPARE(Draupnir::Settings::SettingTraitKey<DoubleSettingTrait>::qString(), DoubleSettingTrait::key());
+
+        // Dispatching key to trait
+        QString visitedKey;
+        const bool visited = ConstexprKeysRegistry::visitTraitByKey("files/last_used_directory",
+            [&visitedKey]<class Trait>() {
+                visitedKey = Draupnir::Settings::SettingTraitKey<Trait>::qString();
+            }
+        );
+        QVERIFY(visited);
+        QCOMPARE(visitedKey, QString{"files/last_used_directory"});
+        QVERIFY(!ConstexprKeysRegistry::visitTraitByKey("files/unknown", []<class Trait>() {}));
+    }
+
+    void test_lazy_loading() {
+        MockSettings otherBackend;
+        SettingsRegistry otherRegistry;
+        otherRegistry.setLazyLoadingEnabled(true);
+        QVERIFY(otherRegistry.isLazyLoadingEnabled());
+        otherRegistry.setBackend(&otherBackend);
+
+        // Nothing is read while attaching the backend.
+        QVERIFY(!otherRegistry.template isSettingLoaded<DoubleSettingTrait>());
+        QVERIFY(!otherRegistry.template isSettingLoaded<BoolSettingTrait>());
+        QVERIFY(!otherRegistry.template isSettingLoaded<ComplexValueSettingTrait>());
+
+        // Value is read on first access, so changes made to the backend before that are visible.
+        const double testDouble = 2.5;
+        otherBackend.setValue(DoubleSettingTrait::key(), testDouble);
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), testDouble);
+        QVERIFY(otherRegistry.template isSettingLoaded<DoubleSettingTrait>());
+
+        // ...and only once.
+        otherBackend.setValue(DoubleSettingTrait::key(), M_E);
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), testDouble);
+
+        // Creating bundle loads its settings.
+        otherBackend.setValue(BoolSettingTrait::key(), false);
+        auto bundle = otherRegistry.template getSettingBundleForTraits<BoolSettingTrait>();
+        QVERIFY(otherRegistry.template isSettingLoaded<BoolSettingTrait>());
+        QCOMPARE(bundle.template get<BoolSettingTrait>(), false);
+
+        // Setting a value marks it as loaded without reading the backend.
+        const ComplexValue value{42,42};
+        otherRegistry.template set<ComplexValueSettingTrait>(value);
+        QVERIFY(otherRegistry.template isSettingLoaded<ComplexValueSettingTrait>());
+        QCOMPARE(otherRegistry.template get<ComplexValueSettingTrait>(), value);
+    }
+
+    void test_write_behind() {
+        MockSettings otherBackend;
+        SettingsRegistry otherRegistry;
+        otherRegistry.setBackend(&otherBackend);
+
+        QCOMPARE(otherRegistry.isWriteBehindEnabled(), false);
+        otherRegistry.setWriteBehindEnabled(true);
+        otherRegistry.setWriteBehindInterval(10);
+        QVERIFY(!otherRegistry.hasPendingWrites());
+
+        // Values set on registry and on bundle are visible immediately, but not yet written to the backend.
+        const double testDouble = M_PI;
+        otherRegistry.template set<DoubleSettingTrait>(testDouble);
+        auto bundle = otherRegistry.template getSettingBundleForTraits<BoolSettingTrait>();
+        bundle.template set<BoolSettingTrait>(false);
+
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), testDouble);
+        QCOMPARE(otherRegistry.template get<BoolSettingTrait>(), false);
+        QVERIFY(otherRegistry.template isPendingWrite<DoubleSettingTrait>());
+        QVERIFY(otherRegistry.template isPendingWrite<BoolSettingTrait>());
+        QVERIFY(!otherRegistry.template isPendingWrite<ComplexValueSettingTrait>());
+        // Fresh backend holds no values, so any value found here would have been written too early.
+        QVERIFY(!otherBackend.template getQVariant<DoubleSettingTrait>().isValid());
+        QVERIFY(!otherBackend.template getQVariant<BoolSettingTrait>().isValid());
+
+        // Explicit commit writes everything at once.
+        otherRegistry.commit();
+        QVERIFY(!otherRegistry.hasPendingWrites());
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), testDouble);
+        QCOMPARE(otherBackend.template getQVariant<BoolSettingTrait>(), false);
+
+        // Pending writes are flushed by timer as well.
+        otherRegistry.template set<DoubleSettingTrait>(M_E);
+        QVERIFY(otherRegistry.hasPendingWrites());
+        QTRY_VERIFY(!otherRegistry.hasPendingWrites());
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), M_E);
+
+        // Disabling write-behind mode writes pending values and returns to immediate writes.
+        otherRegistry.template set<DoubleSettingTrait>(testDouble);
+        otherRegistry.setWriteBehindEnabled(false);
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), testDouble);
+        otherRegistry.template set<DoubleSettingTrait>(M_E);
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), M_E);
+    }
+
+    void test_subscriptions() {
+        MockSettings otherBackend;
+        SettingsRegistry otherRegistry;
+        otherRegistry.setBackend(&otherBackend);
+
+        int doubleCalls = 0;
+        double lastDouble = 0;
+        const auto doubleId = otherRegistry.template subscribe<DoubleSettingTrait>([&](const double& value) {
+            doubleCalls++;
+            lastDouble = value;
+        });
+        QVERIFY(doubleId != 0);
+        QCOMPARE(otherRegistry.template subscriberCount<DoubleSettingTrait>(), 1);
+        QCOMPARE(otherRegistry.template subscriberCount<BoolSettingTrait>(), 0);
+
+        int boolCalls = 0;
+        QObject* context = new QObject;
+        otherRegistry.template subscribe<BoolSettingTrait>(context, [&](const bool&) { boolCalls++; });
+
+        // Successive changes on registry and bundle are coalesced into one notification with the latest value.
+        otherRegistry.template set<DoubleSettingTrait>(1.0);
+        otherRegistry.template set<DoubleSettingTrait>(2.0);
+        auto bundle = otherRegistry.template getSettingBundleForTraits<DoubleSettingTrait>();
+        bundle.template set<DoubleSettingTrait>(3.0);
+        QVERIFY(otherRegistry.hasPendingNotifications());
+        QCOMPARE(doubleCalls, 0);
+
+        QTRY_VERIFY(!otherRegistry.hasPendingNotifications());
+        QCOMPARE(doubleCalls, 1);
+        QCOMPARE(lastDouble, 3.0);
+        QCOMPARE(boolCalls, 0);
+
+        // Changes of traits without subscribers are not tracked.
+        otherRegistry.template set<ComplexValueSettingTrait>(ComplexValue{1,2});
+        QVERIFY(!otherRegistry.hasPendingNotifications());
+
+        // Subscriptions with context end when context is destroyed.
+        otherRegistry.template set<BoolSettingTrait>(true);
+        otherRegistry.flushNotifications();
+        QCOMPARE(boolCalls, 1);
+        delete context;
+        otherRegistry.template set<BoolSettingTrait>(false);
+        otherRegistry.flushNotifications();
+        QCOMPARE(boolCalls, 1);
+        QCOMPARE(otherRegistry.template subscriberCount<BoolSettingTrait>(), 0);
+
+        // Unsubscribed listeners are not called anymore.
+        QVERIFY(otherRegistry.unsubscribe(doubleId));
+        QVERIFY(!otherRegistry.unsubscribe(doubleId));
+        otherRegistry.template set<DoubleSettingTrait>(4.0);
+        otherRegistry.flushNotifications();
+        QCOMPARE(doubleCalls, 1);
+    }
+
+    void test_reload_settings() {
+        MockSettings otherBackend;
+        SettingsRegistry otherRegistry;
+        otherRegistry.setBackend(&otherBackend);
+
+        // Mock backend is not backed by a file.
+        QVERIFY(!otherRegistry.setHotReloadEnabled(true));
+        QVERIFY(!otherRegistry.isHotReloadEnabled());
+
+        int doubleCalls = 0;
+        int boolCalls = 0;
+        otherRegistry.template subscribe<DoubleSettingTrait>([&](const double&) { doubleCalls++; });
+        otherRegistry.template subscribe<BoolSettingTrait>([&](const bool&) { boolCalls++; });
+
+        // Nothing changed - nothing applied.
+        QCOMPARE(otherRegistry.reloadSettings(), 0);
+        QVERIFY(!otherRegistry.hasPendingNotifications());
+
+        // Only changed settings are applied and reported.
+        otherBackend.setValue(DoubleSettingTrait::key(), M_E);
+        otherBackend.setValue(BoolSettingTrait::key(), otherRegistry.template get<BoolSettingTrait>());
+        QCOMPARE(otherRegistry.reloadSettings(), 1);
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), M_E);
+        otherRegistry.flushNotifications();
+        QCOMPARE(doubleCalls, 1);
+        QCOMPARE(boolCalls, 0);
+
+        // Settings with pending writes keep their in-memory values.
+        otherRegistry.setWriteBehindEnabled(true);
+        otherRegistry.template set<DoubleSettingTrait>(1.0);
+        otherBackend.setValue(DoubleSettingTrait::key(), 2.0);
+        QCOMPARE(otherRegistry.reloadSettings(), 0);
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), 1.0);
+        otherRegistry.setWriteBehindEnabled(false);
+    }
+
+    void test_snapshot_restore() {
+        MockSettings otherBackend;
+        SettingsRegistry otherRegistry;
+        otherRegistry.setBackend(&otherBackend);
+
+        otherRegistry.template set<DoubleSettingTrait>(1.0);
+        otherRegistry.template set<BoolSettingTrait>(true);
+        const SettingsRegistry::Snapshot normal = otherRegistry.snapshot();
+        QCOMPARE(normal.template get<DoubleSettingTrait>(), 1.0);
+        QCOMPARE(normal.template get<BoolSettingTrait>(), true);
+
+        SettingsRegistry::Snapshot lowBandwidth = normal;
+        lowBandwidth.template set<DoubleSettingTrait>(2.0);
+        QVERIFY(!(lowBandwidth == normal));
+
+        int doubleCalls = 0;
+        int boolCalls = 0;
+        otherRegistry.template subscribe<DoubleSettingTrait>([&](const double&) { doubleCalls++; });
+        otherRegistry.template subscribe<BoolSettingTrait>([&](const bool&) { boolCalls++; });
+
+        // Only differing settings are applied, persisted and reported.
+        QCOMPARE(otherRegistry.restore(lowBandwidth), 1);
+        QCOMPARE(otherRegistry.template get<DoubleSettingTrait>(), 2.0);
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), 2.0);
+        QVERIFY(!otherRegistry.hasPendingWrites());
+        otherRegistry.flushNotifications();
+        QCOMPARE(doubleCalls, 1);
+        QCOMPARE(boolCalls, 0);
+
+        // Restoring the same snapshot again changes nothing.
+        QCOMPARE(otherRegistry.restore(lowBandwidth), 0);
+        QVERIFY(!otherRegistry.hasPendingNotifications());
+
+        // In write-behind mode restored settings are written by the next commit.
+        otherRegistry.setWriteBehindEnabled(true);
+        QCOMPARE(otherRegistry.restore(normal), 1);
+        QVERIFY(otherRegistry.template isPendingWrite<DoubleSettingTrait>());
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), 2.0);
+        otherRegistry.commit();
+        QCOMPARE(otherBackend.template getQVariant<DoubleSettingTrait>(), 1.0);
+        QVERIFY(otherRegistry.snapshot() == normal);
+    }
+
+    /*! @brief Values written through the registry must reach the file of a buffering backend while the backend is alive. */
+    void test_backend_commit() {
+        QTemporaryDir tempDir;
+        QVERIFY(tempDir.isValid());
+        const QString fileName = tempDir.filePath("settings.bin");
+
+        Draupnir::Settings::BinarySettingsBackend backend{fileName};
+        QVERIFY(backend.load().has_value());
+        SettingsRegistry otherRegistry;
+        otherRegistry.setBackend(&backend);
+
+        const auto readFromFile = [&fileName]() {
+            Draupnir::Settings::BinarySettingsBackend reader{fileName};
+            if (const auto loaded = reader.load(); !loaded)
+                qWarning() << loaded.error();
+            SettingsRegistry readerRegistry;
+            readerRegistry.setBackend(&reader);
+            return std::make_pair(readerRegistry.template get<DoubleSettingTrait>(),
+                                  readerRegistry.template get<BoolSettingTrait>());
+        };
+
+        // Immediate writes on registry and on bundle are committed right away.
+        otherRegistry.template set<DoubleSettingTrait>(M_PI);
+        QVERIFY(!backend.hasPendingChanges());
+        QCOMPARE(readFromFile().first, M_PI);
+
+        auto bundle = otherRegistry.template getSettingBundleForTraits<BoolSettingTrait>();
+        bundle.template set<BoolSettingTrait>(false);
+        QVERIFY(!backend.hasPendingChanges());
+        QCOMPARE(readFromFile().second, false);
+
+        // In write-behind mode the batch is committed by commit.
+        otherRegistry.setWriteBehindEnabled(true);
+        otherRegistry.template set<DoubleSettingTrait>(M_E);
+        bundle.template set<BoolSettingTrait>(true);
+        QCOMPARE(readFromFile(), std::make_pair(M_PI, false));
+        otherRegistry.commit();
+        QVERIFY(!backend.hasPendingChanges());
+        QCOMPARE(readFromFile(), std::make_pair(M_E, true));
+
+        // ...and by restore.
+        SettingsRegistry::Snapshot snapshot = otherRegistry.snapshot();
+        snapshot.template set<DoubleSettingTrait>(1.0);
+        otherRegistry.setWriteBehindEnabled(false);
+        QCOMPARE(otherRegistry.restore(snapshot), 1);
+        QCOMPARE(readFromFile().first, 1.0);
+    }
 };
 
 QTEST_MAIN(SettingsRegistryIT)
@@ -0,0 +1,270 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+#include "draupnir/settings_registry/SettingsRegistryTemplate.h"
+#include "draupnir/settings_registry/core/BinarySettingsBackend.h"
+
+#include "draupnir-test/traits/settings/BoolSettingTraits.h"
+#include "draupnir-test/traits/settings/DoubleSettingTraits.h"
+#include "draupnir-test/traits/settings/IntegerSettingTraits.h"
+#include "draupnir-test/traits/settings/StringSettingTraits.h"
+
+using Draupnir::Settings::BinarySettingsBackend;
+
+/*! @class BinarySettingsBackendTest tests/modules/settings_registry/unit/BinarySettingsBackendTest/BinarySettingsBackendTest.cpp
+ *  @ingroup SettingsRegistryTests
+ *  @brief This test class tests functionality of the @ref Draupnir::Settings::BinarySettingsBackend. */
+
+class BinarySettingsBackendTest final : public QObject
+{
+    Q_OBJECT
+
+public:
+    using SettingsRegistry = Draupnir::Settings::SettingsRegistryTemplate<
+        BoolSettingTrait,
+        DoubleSettingTrait,
+        IntSettingTrait,
+        QStringSettingTrait,
+        QStringListSettingTrait
+    >;
+
+    QTemporaryDir tempDir;
+
+    QString settingsFile() const { return tempDir.filePath("settings.bin"); }
+
+private slots:
+    void init() {
+        QFile::remove(settingsFile());
+    }
+
+    void test_missing_file() {
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+        QCOMPARE(backend.count(), 0);
+        QVERIFY(!backend.contains("key"));
+        QCOMPARE(backend.value("key", 42), QVariant{42});
+        QVERIFY(!backend.getInt64("key").has_value());
+    }
+
+    void test_commit_and_load() {
+        const QByteArray bytes{"\x00\x01\x02\xff", 4};
+        {
+            BinarySettingsBackend backend{settingsFile()};
+            QVERIFY(backend.load().has_value());
+
+            backend.setInt64("int", -42);
+            backend.setDouble("double", M_PI);
+            backend.setString("string", QString::fromUtf8("Привіт, settings"));
+            backend.setBytes("bytes", bytes);
+            backend.setValue("variant", QStringList{"one", "two"});
+            backend.setString(QString::fromUtf8("ключ"), "non-ascii key");
+
+            // Pending values are visible before commit
+            QVERIFY(backend.hasPendingChanges());
+            QCOMPARE(backend.getInt64("int"), std::optional<qint64>{-42});
+            QCOMPARE(backend.count(), 6);
+
+            QVERIFY(backend.commit().has_value());
+            QVERIFY(!backend.hasPendingChanges());
+            QCOMPARE(backend.count(), 6);
+            QCOMPARE(backend.getInt64("int"), std::optional<qint64>{-42});
+        }
+
+        // Only the settings file is left after the atomic replace
+        QCOMPARE(QDir{tempDir.path()}.entryList(QDir::Files), QStringList{"settings.bin"});
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+        QCOMPARE(backend.count(), 6);
+        QCOMPARE(backend.getInt64("int"), std::optional<qint64>{-42});
+        QCOMPARE(backend.getDouble("double"), std::optional<double>{M_PI});
+        QCOMPARE(backend.getString("string"), std::optional<QString>{QString::fromUtf8("Привіт, settings")});
+        QCOMPARE(backend.getBytes("bytes"), std::optional<QByteArray>{bytes});
+        QCOMPARE(backend.value("variant").toStringList(), (QStringList{"one", "two"}));
+        QCOMPARE(backend.getString(QString::fromUtf8("ключ")), std::optional<QString>{"non-ascii key"});
+
+        // QVariant access to typed values and strict typed access
+        QCOMPARE(backend.value("int"), QVariant{qint64{-42}});
+        QVERIFY(!backend.getDouble("int").has_value());
+        QVERIFY(!backend.getInt64("variant").has_value());
+        QVERIFY(!backend.contains("missing"));
+
+        // Changing one value keeps the others
+        backend.setInt64("int", 7);
+        QVERIFY(backend.commit().has_value());
+        QCOMPARE(backend.count(), 6);
+        QCOMPARE(backend.getInt64("int"), std::optional<qint64>{7});
+        QCOMPARE(backend.getDouble("double"), std::optional<double>{M_PI});
+    }
+
+    void test_destructor_commits() {
+        {
+            BinarySettingsBackend backend{settingsFile()};
+            QVERIFY(backend.load().has_value());
+            backend.setString("string", "value");
+        }
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+        QCOMPARE(backend.getString("string"), std::optional<QString>{"value"});
+    }
+
+    void test_invalid_files() {
+        QFile file{settingsFile()};
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("This is not a settings file.");
+        file.close();
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(!backend.load().has_value());
+        QCOMPARE(backend.count(), 0);
+
+        // Unsupported version
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QByteArray header(16, '\0');
+        qToLittleEndian<quint32>(0x54535244, header.data());
+        qToLittleEndian<quint16>(BinarySettingsBackend::formatVersion + 1, header.data() + 4);
+        file.write(header);
+        file.close();
+        QVERIFY(!backend.load().has_value());
+
+        // Truncated index
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        qToLittleEndian<quint16>(BinarySettingsBackend::formatVersion, header.data() + 4);
+        qToLittleEndian<quint32>(10, header.data() + 8);
+        file.write(header);
+        file.close();
+        QVERIFY(!backend.load().has_value());
+    }
+
+    void test_registry_integration() {
+        const QStringList list{"/etc/hosts", "/etc/passwd"};
+        {
+            BinarySettingsBackend backend{settingsFile()};
+            QVERIFY(backend.load().has_value());
+
+            SettingsRegistry registry;
+            registry.setBackend(&backend);
+            registry.set<BoolSettingTrait>(false);
+            registry.set<DoubleSettingTrait>(M_E);
+            registry.set<IntSettingTrait>(1234);
+            registry.set<QStringSettingTrait>("value");
+            registry.set<QStringListSettingTrait>(list);
+        }
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+
+        SettingsRegistry registry;
+        registry.setBackend(&backend);
+        QCOMPARE(registry.get<BoolSettingTrait>(), false);
+        QCOMPARE(registry.get<DoubleSettingTrait>(), M_E);
+        QCOMPARE(registry.get<IntSettingTrait>(), 1234);
+        QCOMPARE(registry.get<QStringSettingTrait>(), QString{"value"});
+        QCOMPARE(registry.get<QStringListSettingTrait>(), list);
+
+        // Primitive values are stored natively
+        QCOMPARE(backend.getInt64(IntSettingTrait::key()), std::optional<qint64>{1234});
+    }
+
+    void test_registry_reads_values_stored_through_variant() {
+        {
+            BinarySettingsBackend backend{settingsFile()};
+            QVERIFY(backend.load().has_value());
+
+            // Stored by code predating the typed access, or under a different native type.
+            backend.setValue(BoolSettingTrait::key(), false);
+            backend.setValue(IntSettingTrait::key(), 1234);
+            backend.setValue(QStringSettingTrait::key(), QString{"value"});
+            backend.setInt64(DoubleSettingTrait::key(), 3);
+        }
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+        QVERIFY(!backend.getInt64(IntSettingTrait::key()).has_value());
+
+        SettingsRegistry registry;
+        registry.setBackend(&backend);
+        QCOMPARE(registry.get<BoolSettingTrait>(), false);
+        QCOMPARE(registry.get<IntSettingTrait>(), 1234);
+        QCOMPARE(registry.get<QStringSettingTrait>(), QString{"value"});
+        QCOMPARE(registry.get<DoubleSettingTrait>(), 3.0);
+    }
+
+    void test_hot_reload() {
+        {
+            BinarySettingsBackend writer{settingsFile()};
+            writer.setInt64(IntSettingTrait::key(), 1);
+            writer.setDouble(DoubleSettingTrait::key(), M_E);
+            QVERIFY(writer.commit().has_value());
+        }
+
+        BinarySettingsBackend backend{settingsFile()};
+        QVERIFY(backend.load().has_value());
+        QCOMPARE(backend.fileName(), settingsFile());
+
+        SettingsRegistry registry;
+        registry.setBackend(&backend);
+        QVERIFY(registry.setHotReloadEnabled(true));
+
+        int intCalls = 0;
+        int doubleCalls = 0;
+        registry.subscribe<IntSettingTrait>([&](const int&) { intCalls++; });
+        registry.subscribe<DoubleSettingTrait>([&](const double&) { doubleCalls++; });
+
+        // File is replaced by another process: only the changed setting is applied and reported.
+        {
+            BinarySettingsBackend writer{settingsFile()};
+            QVERIFY(writer.load().has_value());
+            writer.setInt64(IntSettingTrait::key(), 2);
+            QVERIFY(writer.commit().has_value());
+        }
+
+        QTRY_COMPARE(registry.get<IntSettingTrait>(), 2);
+        QTRY_COMPARE(intCalls, 1);
+        QCOMPARE(doubleCalls, 0);
+        QCOMPARE(registry.get<DoubleSettingTrait>(), M_E);
+
+        // Replaced file is still watched.
+        {
+            BinarySettingsBackend writer{settingsFile()};
+            QVERIFY(writer.load().has_value());
+            writer.setInt64(IntSettingTrait::key(), 3);
+            QVERIFY(writer.commit().has_value());
+        }
+        QTRY_COMPARE(registry.get<IntSettingTrait>(), 3);
+
+        QVERIFY(registry.setHotReloadEnabled(false));
+        QVERIFY(!registry.isHotReloadEnabled());
+    }
+};
+
+QTEST_MAIN(BinarySettingsBackendTest)
+
+#include "BinarySettingsBackendTest.moc"
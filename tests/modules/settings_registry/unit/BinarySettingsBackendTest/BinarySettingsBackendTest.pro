@@ -0,0 +1,11 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+DEFINES += DRAUPNIR_SETTINGS_USE_CUSTOM
+
+include(../../../../common/SettingsTraits.pri)
+
+include(../../../../../modules/SettingsRegistry.pri)
+
+SOURCES +=  \
+    BinarySettingsBackendTest.cpp
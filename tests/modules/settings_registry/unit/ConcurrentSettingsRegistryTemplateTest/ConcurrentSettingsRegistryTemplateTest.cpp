@@ -0,0 +1,160 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+#include <QCoreApplication>
+
+#include <atomic>
+#include <thread>
+
+#include "draupnir/settings_registry/ConcurrentSettingsRegistryTemplate.h"
+
+#include "draupnir-test/mocks/SettingsBackendMockTemplate.h"
+#include "draupnir-test/traits/settings/BoolSettingTraits.h"
+#include "draupnir-test/traits/settings/DoubleSettingTraits.h"
+#include "draupnir-test/traits/settings/StringSettingTraits.h"
+
+using namespace Draupnir::Settings;
+
+/*! @brief Trivially-copyable value which is too large for lock-free `std::atomic`. */
+struct WideValue
+{
+    qint64 first = 0;
+    qint64 second = 0;
+    qint64 third = 0;
+};
+
+/*! @class ConcurrentSettingsRegistryTemplateTest tests/modules/settings_registry/unit/ConcurrentSettingsRegistryTemplateTest/ConcurrentSettingsRegistryTemplateTest.cpp
+ *  @ingroup SettingsRegistryTests
+ *  @brief This test class tests functionality of the @ref Draupnir::Settings::ConcurrentSettingsRegistryTemplate and
+ *         @ref Draupnir::Settings::ConcurrentValueTemplate. */
+
+class ConcurrentSettingsRegistryTemplateTest final : public QObject
+{
+    Q_OBJECT
+
+public:
+    using MockSettings = SettingsBackendMockTemplate<
+        BoolSettingTrait,
+        DoubleSettingTrait,
+        QStringListSettingTrait
+    >;
+
+    using SettingsRegistry = ConcurrentSettingsRegistryTemplate<
+        BoolSettingTrait,
+        DoubleSettingTrait,
+        QStringListSettingTrait
+    >;
+
+private slots:
+    void test_publishing_kinds() {
+        QCOMPARE(ConcurrentValueTemplate<bool>::kind, ConcurrentValueKind::Atomic);
+        QCOMPARE(ConcurrentValueTemplate<double>::kind, ConcurrentValueKind::Atomic);
+        QCOMPARE(ConcurrentValueTemplate<WideValue>::kind, ConcurrentValueKind::SequenceLock);
+        QCOMPARE(ConcurrentValueTemplate<QStringList>::kind, ConcurrentValueKind::Snapshot);
+
+        QCOMPARE(SettingsRegistry::template publishingKind<DoubleSettingTrait>(), ConcurrentValueKind::Atomic);
+        QCOMPARE(SettingsRegistry::template publishingKind<QStringListSettingTrait>(), ConcurrentValueKind::Snapshot);
+    }
+
+    void test_values_are_published() {
+        MockSettings backend;
+        backend.setValue(DoubleSettingTrait::key(), 2.5);
+
+        SettingsRegistry registry;
+        QCOMPARE(registry.template load<DoubleSettingTrait>(), DoubleSettingTrait::defaultValue());
+
+        // Values read from the backend are published.
+        registry.setBackend(&backend);
+        QCOMPARE(registry.template load<DoubleSettingTrait>(), 2.5);
+        QCOMPARE(registry.template load<QStringListSettingTrait>(), QStringListSettingTrait::defaultValue());
+
+        // Values changed on the registry and on bundles are published.
+        registry.template set<BoolSettingTrait>(true);
+        QCOMPARE(registry.template load<BoolSettingTrait>(), true);
+
+        const auto oldSnapshot = registry.template snapshot<QStringListSettingTrait>();
+        auto bundle = registry.template getSettingBundleForTraits<QStringListSettingTrait>();
+        bundle.template set<QStringListSettingTrait>(QStringList{"first", "second"});
+        QCOMPARE(registry.template load<QStringListSettingTrait>(), (QStringList{"first", "second"}));
+
+        // Snapshots obtained before are not affected.
+        QCOMPARE(*oldSnapshot, QStringListSettingTrait::defaultValue());
+    }
+
+    void test_sequence_lock_reads_are_consistent() {
+        ConcurrentValueTemplate<WideValue> value{WideValue{}};
+        std::atomic<bool> stop{false};
+        std::atomic<int> tornReads{0};
+
+        std::thread reader{[&]() {
+            while (!stop.load()) {
+                const WideValue current = value.load();
+                if (current.first != current.second || current.second != current.third)
+                    tornReads++;
+            }
+        }};
+
+        for (qint64 i = 1; i <= 200000; i++)
+            value.store(WideValue{i, i, i});
+
+        stop.store(true);
+        reader.join();
+
+        QCOMPARE(tornReads.load(), 0);
+        QCOMPARE(value.load().third, qint64{200000});
+    }
+
+    void test_snapshot_reads_from_worker() {
+        MockSettings backend;
+        SettingsRegistry registry;
+        registry.setBackend(&backend);
+        registry.template set<QStringListSettingTrait>(QStringList{"0", "0"});
+
+        std::atomic<bool> stop{false};
+        std::atomic<int> invalidReads{0};
+
+        std::thread reader{[&]() {
+            while (!stop.load()) {
+                const auto snapshot = registry.template snapshot<QStringListSettingTrait>();
+                if (snapshot->size() != 2 || snapshot->first() != snapshot->last())
+                    invalidReads++;
+            }
+        }};
+
+        for (int i = 1; i <= 10000; i++)
+            registry.template set<QStringListSettingTrait>(QStringList{QString::number(i), QString::number(i)});
+
+        stop.store(true);
+        reader.join();
+
+        QCOMPARE(invalidReads.load(), 0);
+        QCOMPARE(registry.template load<QStringListSettingTrait>(), (QStringList{"10000", "10000"}));
+    }
+};
+
+QTEST_APPLESS_MAIN(ConcurrentSettingsRegistryTemplateTest)
+
+#include "ConcurrentSettingsRegistryTemplateTest.moc"
@@ -0,0 +1,12 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+DEFINES += DRAUPNIR_SETTINGS_USE_CUSTOM
+
+include(../../../../common/SettingsBackendMockTemplate.pri)
+include(../../../../common/SettingsTraits.pri)
+
+include(../../../../../modules/SettingsRegistry.pri)
+
+SOURCES +=  \
+    ConcurrentSettingsRegistryTemplateTest.cpp
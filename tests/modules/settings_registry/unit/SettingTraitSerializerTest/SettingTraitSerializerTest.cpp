@@ -24,12 +24,55 @@
 
 #include <QtTest>
 
+#include "draupnir/settings_registry/core/TypedSettingsBackendInterface.h"
 #include "draupnir/settings_registry/utils/SettingTraitSerializer.h"
 
 #include "draupnir-test/mocks/SettingsBackendMockTemplate.h"
+#include "draupnir-test/traits/settings/BoolSettingTraits.h"
 #include "draupnir-test/traits/settings/DoubleSettingTraits.h"
+#include "draupnir-test/traits/settings/IntegerSettingTraits.h"
 #include "draupnir-test/traits/settings/StringSettingTraits.h"
 
+/*! @class TypedBackendMock tests/modules/settings_registry/unit/SettingTraitSerializerTest/SettingTraitSerializerTest.cpp
+ *  @ingroup SettingsRegistryTests
+ *  @brief Backend storing values natively and counting calls of its `QVariant`-based methods. */
+
+class TypedBackendMock final : public Draupnir::Settings::TypedSettingsBackendInterface
+{
+public:
+    int variantCalls = 0;
+    QHash<QString,qint64> integers;
+    QHash<QString,double> doubles;
+    QHash<QString,QString> strings;
+    QHash<QString,QVariant> variants;
+
+    bool contains(const QString& key) const final { return variants.contains(key); }
+    QVariant value(const QString& key, const QVariant& defaultValue = QVariant{}) final {
+        variantCalls++;
+        return variants.value(key, defaultValue);
+    }
+    void setValue(const QString& key, const QVariant& value) final {
+        variantCalls++;
+        variants.insert(key, value);
+    }
+
+    std::optional<qint64> getInt64(const QString& key) final { return _find(integers, key); }
+    void setInt64(const QString& key, qint64 value) final { integers.insert(key, value); }
+    std::optional<double> getDouble(const QString& key) final { return _find(doubles, key); }
+    void setDouble(const QString& key, double value) final { doubles.insert(key, value); }
+    std::optional<QString> getString(const QString& key) final { return _find(strings, key); }
+    void setString(const QString& key, const QString& value) final { strings.insert(key, value); }
+    std::optional<QByteArray> getBytes(const QString&) final { return std::nullopt; }
+    void setBytes(const QString&, const QByteArray&) final {}
+
+private:
+    template<class Value>
+    static std::optional<Value> _find(const QHash<QString,Value>& hash, const QString& key) {
+        const auto iter = hash.constFind(key);
+        return (iter != hash.constEnd()) ? std::optional<Value>{iter.value()} : std::nullopt;
+    }
+};
+
 /*! @class SettingTraitSerializerTest tests/modules/settings_registry/unit/SettingTraitSerializerTest/SettingTraitSerializerTest.cpp
  *  @ingroup SettingsRegistryTests
  *  @brief This test class tests functionality of the SettingTraitSerializer.
@@ -80,6 +123,43 @@ private slots:
         QStringListSerializer::set(&mockBackend, dummyStringList);
         QCOMPARE(QStringListSerializer::get(&mockBackend), dummyStringList);
     }
+
+    void test_typed_backend() {
+        using Draupnir::Settings::SettingsBackendInterface;
+        using Draupnir::Settings::SettingTraitSerializer;
+        static_assert(Draupnir::Settings::TypedSettingsBackendConcept<TypedBackendMock>);
+        static_assert(!Draupnir::Settings::TypedSettingsBackendConcept<MockBackend>);
+
+        TypedBackendMock typedBackend;
+        SettingsBackendInterface* backend = &typedBackend;
+        QVERIFY(backend->typedBackend() == &typedBackend);
+        QVERIFY(mockBackend.typedBackend() == nullptr);
+
+        // Missing values are reported as defaults
+        QCOMPARE((SettingTraitSerializer<SettingsBackendInterface,IntSettingTrait>::get(backend)), IntSettingTrait::defaultValue());
+
+        // Primitive values go through typed methods, both via interface pointer and via concrete backend type.
+        SettingTraitSerializer<SettingsBackendInterface,IntSettingTrait>::set(backend, 42);
+        SettingTraitSerializer<SettingsBackendInterface,BoolSettingTrait>::set(backend, true);
+        SettingTraitSerializer<TypedBackendMock,DoubleSettingTrait>::set(&typedBackend, M_E);
+        SettingTraitSerializer<SettingsBackendInterface,QStringSettingTrait>::set(backend, dummyString);
+
+        QCOMPARE(typedBackend.integers.value(IntSettingTrait::key()), qint64{42});
+        QCOMPARE(typedBackend.integers.value(BoolSettingTrait::key()), qint64{1});
+        QCOMPARE(typedBackend.doubles.value(DoubleSettingTrait::key()), M_E);
+        QCOMPARE(typedBackend.strings.value(QStringSettingTrait::key()), dummyString);
+
+        QCOMPARE((SettingTraitSerializer<SettingsBackendInterface,IntSettingTrait>::get(backend)), 42);
+        QCOMPARE((SettingTraitSerializer<SettingsBackendInterface,BoolSettingTrait>::get(backend)), true);
+        QCOMPARE((SettingTraitSerializer<SettingsBackendInterface,DoubleSettingTrait>::get(backend)), M_E);
+        QCOMPARE((SettingTraitSerializer<TypedBackendMock,QStringSettingTrait>::get(&typedBackend)), dummyString);
+        QCOMPARE(typedBackend.variantCalls, 0);
+
+        // Other values still use QVariant
+        SettingTraitSerializer<SettingsBackendInterface,QStringListSettingTrait>::set(backend, dummyStringList);
+        QCOMPARE((SettingTraitSerializer<SettingsBackendInterface,QStringListSettingTrait>::get(backend)), dummyStringList);
+        QCOMPARE(typedBackend.variantCalls, 2);
+    }
 };
 
 QTEST_MAIN(SettingTraitSerializerTest)
@@ -0,0 +1,101 @@
+/*
+ **********************************************************************************************************************
+ *
+ * draupnir-lib
+ * Copyright (C) 2026 Ivan Odinets <i_odinets@protonmail.com>
+ *
+ * This file is part of draupnir-lib
+ *
+ * draupnir-lib is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * draupnir-lib is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with draupnir-lib; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include <QtTest>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "draupnir/utils/static_perfect_hash.h"
+
+using namespace draupnir::utils;
+
+/*! @class StaticPerfectHashTest tests/modules/utils/unit/static_perfect_hash_test/StaticPerfectHashTest.cpp
+ *  @brief Test class for testing entities present within @ref draupnir/utils/static_perfect_hash.h. */
+
+class StaticPerfectHashTest final : public QObject
+{
+    Q_OBJECT
+public:
+
+private slots:
+    void test_fnv1a_64() {
+        static_assert(fnv1a_64("") == 0xcbf29ce484222325ull);
+        static_assert(fnv1a_64("a") == 0xaf63dc4c8601ec8cull);
+        QVERIFY(fnv1a_64("files/recent_files") != fnv1a_64("files/last_used_directory"));
+    }
+
+    void test_compile_time_table() {
+        static constexpr static_perfect_hash<3> table{{"one", "two", "three"}};
+        static_assert(table.find("one") == 0);
+        static_assert(table.find("two") == 1);
+        static_assert(table.find("three") == 2);
+        static_assert(!table.find("four").has_value());
+        static_assert(table.key(2) == "three");
+
+        static constexpr static_perfect_hash<0> emptyTable{{}};
+        static_assert(!emptyTable.contains("one"));
+
+        QCOMPARE(table.find("two"), std::optional<std::size_t>{1});
+        QVERIFY(!table.contains(""));
+    }
+
+    void test_duplicated_keys() {
+        static_assert(static_perfect_hash<3>::has_duplicates({"one", "two", "one"}));
+        static_assert(!static_perfect_hash<3>::has_duplicates({"one", "two", "three"}));
+
+        bool thrown = false;
+        try {
+            static_perfect_hash<3> table{{"one", "two", "one"}};
+            Q_UNUSED(table);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        QVERIFY(thrown);
+    }
+
+    void test_many_keys() {
+        constexpr std::size_t keysCount = 1000;
+        std::vector<std::string> storage;
+        for (std::size_t i = 0; i < keysCount; i++)
+            storage.push_back("group_" + std::to_string(i % 10) + "/key_" + std::to_string(i));
+
+        std::array<std::string_view,keysCount> keys;
+        for (std::size_t i = 0; i < keysCount; i++)
+            keys[i] = storage[i];
+
+        const auto table = std::make_unique<static_perfect_hash<keysCount>>(keys);
+        for (std::size_t i = 0; i < keysCount; i++)
+            QCOMPARE(table->find(keys[i]), std::optional<std::size_t>{i});
+
+        QVERIFY(!table->contains("group_0/key_1000"));
+        QVERIFY(!table->contains("group_0/"));
+    }
+};
+
+QTEST_APPLESS_MAIN(StaticPerfectHashTest)
+
+#include "StaticPerfectHashTest.moc"
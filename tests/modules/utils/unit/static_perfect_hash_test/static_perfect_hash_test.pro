@@ -0,0 +1,7 @@
+TEST_NAME = $$basename(PWD)
+include(../../../../common/TestConfig.pri)
+
+include(../../../../../modules/Utils.pri)
+
+SOURCES +=  \
+    StaticPerfectHashTest.cpp